@@ -70,6 +70,54 @@ impl Cli {
             "",
             "unittests",
             "Perform unit tests. E.g. 'ja2.exe -unittests --gtest_output=\"xml:report.xml\" --gtest_repeat=2'");
+        opts.optopt(
+            "",
+            "aibenchmark",
+            "Run the enemy AI headless in the given sector, report timings and exit. E.g. 'ja2.exe -aibenchmark A9 -aibenchmarkturns 20'",
+            "SECTOR",
+        );
+        opts.optopt(
+            "",
+            "aibenchmarkturns",
+            "Number of enemy turns to run the AI benchmark for. Default value is 10",
+            "TURNS",
+        );
+        opts.optopt(
+            "",
+            "aibenchmarkseed",
+            "Random seed for the AI benchmark. Default value is 0",
+            "SEED",
+        );
+        opts.optopt(
+            "",
+            "autoresolvesim",
+            "Autoresolve the battle in the given sector many times, report the outcomes and exit. E.g. 'ja2.exe -autoresolvesim D13 -autoresolvesimbattles 5000'",
+            "SECTOR",
+        );
+        opts.optopt(
+            "",
+            "autoresolvesimbattles",
+            "Number of battles the autoresolve simulation fights. Default value is 1000",
+            "BATTLES",
+        );
+        opts.optopt(
+            "",
+            "autoresolvesimseed",
+            "Random seed of the first battle of the autoresolve simulation. Default value is 0",
+            "SEED",
+        );
+        opts.optopt(
+            "",
+            "strategicbenchmark",
+            "Fast-forward a new campaign by the given number of days headless, report the throughput and exit. E.g. 'ja2.exe -strategicbenchmark 30'",
+            "DAYS",
+        );
+        opts.optopt(
+            "",
+            "strategicbenchmarkseed",
+            "Random seed for the strategic benchmark. Default value is 0",
+            "SEED",
+        );
         opts.optflag(
             "",
             "editor",
@@ -157,6 +205,70 @@ impl Cli {
                     engine_options.run_unittests = true;
                 }
 
+                if let Some(s) = m.opt_str("aibenchmark") {
+                    engine_options.ai_benchmark_sector = Some(s);
+                }
+
+                if let Some(s) = m.opt_str("aibenchmarkturns") {
+                    match s.parse::<u32>() {
+                        Ok(val) => {
+                            engine_options.ai_benchmark_turns = val;
+                        }
+                        Err(_e) => return Err(String::from("Incorrect AI benchmark turn count.")),
+                    }
+                }
+
+                if let Some(s) = m.opt_str("aibenchmarkseed") {
+                    match s.parse::<u32>() {
+                        Ok(val) => {
+                            engine_options.ai_benchmark_seed = val;
+                        }
+                        Err(_e) => return Err(String::from("Incorrect AI benchmark seed.")),
+                    }
+                }
+
+                if let Some(s) = m.opt_str("autoresolvesim") {
+                    engine_options.autoresolve_sim_sector = Some(s);
+                }
+
+                if let Some(s) = m.opt_str("autoresolvesimbattles") {
+                    match s.parse::<u32>() {
+                        Ok(val) => {
+                            engine_options.autoresolve_sim_battles = val;
+                        }
+                        Err(_e) => {
+                            return Err(String::from("Incorrect autoresolve simulation battle count."))
+                        }
+                    }
+                }
+
+                if let Some(s) = m.opt_str("autoresolvesimseed") {
+                    match s.parse::<u32>() {
+                        Ok(val) => {
+                            engine_options.autoresolve_sim_seed = val;
+                        }
+                        Err(_e) => return Err(String::from("Incorrect autoresolve simulation seed.")),
+                    }
+                }
+
+                if let Some(s) = m.opt_str("strategicbenchmark") {
+                    match s.parse::<u32>() {
+                        Ok(val) => {
+                            engine_options.strategic_benchmark_days = Some(val);
+                        }
+                        Err(_e) => return Err(String::from("Incorrect strategic benchmark day count.")),
+                    }
+                }
+
+                if let Some(s) = m.opt_str("strategicbenchmarkseed") {
+                    match s.parse::<u32>() {
+                        Ok(val) => {
+                            engine_options.strategic_benchmark_seed = val;
+                        }
+                        Err(_e) => return Err(String::from("Incorrect strategic benchmark seed.")),
+                    }
+                }
+
                 if m.opt_present("editor") {
                     engine_options.run_editor = true;
                 }
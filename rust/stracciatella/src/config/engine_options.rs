@@ -34,6 +34,22 @@ pub struct EngineOptions {
     pub start_in_debug_mode: bool,
     /// Whether to enable sound
     pub start_without_sound: bool,
+    /// Sector to run the headless AI benchmark in, e.g. "A9"
+    pub ai_benchmark_sector: Option<String>,
+    /// Number of enemy turns the AI benchmark runs for
+    pub ai_benchmark_turns: u32,
+    /// Random seed the AI benchmark starts from
+    pub ai_benchmark_seed: u32,
+    /// Sector to run the headless autoresolve simulation in, e.g. "D13"
+    pub autoresolve_sim_sector: Option<String>,
+    /// Number of battles the autoresolve simulation fights
+    pub autoresolve_sim_battles: u32,
+    /// Random seed of the first battle of the autoresolve simulation
+    pub autoresolve_sim_seed: u32,
+    /// Number of days the headless strategic benchmark fast-forwards a new campaign by
+    pub strategic_benchmark_days: Option<u32>,
+    /// Random seed the strategic benchmark starts from
+    pub strategic_benchmark_seed: u32,
 }
 
 impl Default for EngineOptions {
@@ -53,6 +69,14 @@ impl Default for EngineOptions {
             scaling_quality: ScalingQuality::default(),
             start_in_debug_mode: false,
             start_without_sound: false,
+            ai_benchmark_sector: None,
+            ai_benchmark_turns: 10,
+            ai_benchmark_seed: 0,
+            autoresolve_sim_sector: None,
+            autoresolve_sim_battles: 1000,
+            autoresolve_sim_seed: 0,
+            strategic_benchmark_days: None,
+            strategic_benchmark_seed: 0,
         }
     }
 }
@@ -185,6 +185,51 @@ mod tests {
         assert_eq!(engine_options.resource_version, VanillaVersion::ITALIAN);
     }
 
+    #[test]
+    fn parse_args_should_return_the_ai_benchmark_options() {
+        let mut engine_options = EngineOptions::default();
+        let input = vec![
+            String::from("ja2"),
+            String::from("-aibenchmark"),
+            String::from("A9"),
+            String::from("-aibenchmarkturns"),
+            String::from("25"),
+        ];
+        assert_eq!(parse_args(&mut engine_options, &input), None);
+        assert_eq!(engine_options.ai_benchmark_sector, Some(String::from("A9")));
+        assert_eq!(engine_options.ai_benchmark_turns, 25);
+        assert_eq!(engine_options.ai_benchmark_seed, 0);
+    }
+
+    #[test]
+    fn parse_args_should_return_the_autoresolve_simulation_options() {
+        let mut engine_options = EngineOptions::default();
+        let input = vec![
+            String::from("ja2"),
+            String::from("-autoresolvesim"),
+            String::from("D13"),
+            String::from("-autoresolvesimseed"),
+            String::from("7"),
+        ];
+        assert_eq!(parse_args(&mut engine_options, &input), None);
+        assert_eq!(engine_options.autoresolve_sim_sector, Some(String::from("D13")));
+        assert_eq!(engine_options.autoresolve_sim_battles, 1000);
+        assert_eq!(engine_options.autoresolve_sim_seed, 7);
+    }
+
+    #[test]
+    fn parse_args_should_return_the_strategic_benchmark_options() {
+        let mut engine_options = EngineOptions::default();
+        let input = vec![
+            String::from("ja2"),
+            String::from("-strategicbenchmark"),
+            String::from("30"),
+        ];
+        assert_eq!(parse_args(&mut engine_options, &input), None);
+        assert_eq!(engine_options.strategic_benchmark_days, Some(30));
+        assert_eq!(engine_options.strategic_benchmark_seed, 0);
+    }
+
     #[test]
     fn parse_args_should_return_the_correct_resolution() {
         let mut engine_options = EngineOptions::default();
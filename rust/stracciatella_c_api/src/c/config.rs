@@ -177,6 +177,70 @@ pub extern "C" fn EngineOptions_shouldRunUnittests(ptr: *const EngineOptions) ->
     engine_options.run_unittests
 }
 
+/// Gets `EngineOptions.ai_benchmark_sector` or null if no AI benchmark was requested.
+/// The caller is responsible for the returned memory.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getAIBenchmarkSector(ptr: *const EngineOptions) -> *mut c_char {
+    let engine_options = unsafe_ref(ptr);
+    match &engine_options.ai_benchmark_sector {
+        Some(sector) => c_string_from_str(sector).into_raw(),
+        None => ptr::null_mut(),
+    }
+}
+
+/// Gets `EngineOptions.ai_benchmark_turns`.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getAIBenchmarkTurns(ptr: *const EngineOptions) -> u32 {
+    let engine_options = unsafe_ref(ptr);
+    engine_options.ai_benchmark_turns
+}
+
+/// Gets `EngineOptions.ai_benchmark_seed`.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getAIBenchmarkSeed(ptr: *const EngineOptions) -> u32 {
+    let engine_options = unsafe_ref(ptr);
+    engine_options.ai_benchmark_seed
+}
+
+/// Gets `EngineOptions.autoresolve_sim_sector` or null if no autoresolve simulation was requested.
+/// The caller is responsible for the returned memory.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getAutoResolveSimSector(ptr: *const EngineOptions) -> *mut c_char {
+    let engine_options = unsafe_ref(ptr);
+    match &engine_options.autoresolve_sim_sector {
+        Some(sector) => c_string_from_str(sector).into_raw(),
+        None => ptr::null_mut(),
+    }
+}
+
+/// Gets `EngineOptions.autoresolve_sim_battles`.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getAutoResolveSimBattles(ptr: *const EngineOptions) -> u32 {
+    let engine_options = unsafe_ref(ptr);
+    engine_options.autoresolve_sim_battles
+}
+
+/// Gets `EngineOptions.autoresolve_sim_seed`.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getAutoResolveSimSeed(ptr: *const EngineOptions) -> u32 {
+    let engine_options = unsafe_ref(ptr);
+    engine_options.autoresolve_sim_seed
+}
+
+/// Gets `EngineOptions.strategic_benchmark_days` or 0 if no strategic benchmark was requested.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getStrategicBenchmarkDays(ptr: *const EngineOptions) -> u32 {
+    let engine_options = unsafe_ref(ptr);
+    engine_options.strategic_benchmark_days.unwrap_or(0)
+}
+
+/// Gets `EngineOptions.strategic_benchmark_seed`.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getStrategicBenchmarkSeed(ptr: *const EngineOptions) -> u32 {
+    let engine_options = unsafe_ref(ptr);
+    engine_options.strategic_benchmark_seed
+}
+
 /// Gets `EngineOptions.show_help`.
 #[no_mangle]
 pub extern "C" fn EngineOptions_shouldShowHelp(ptr: *const EngineOptions) -> bool {
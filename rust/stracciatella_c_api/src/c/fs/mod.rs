@@ -54,6 +54,26 @@ pub extern "C" fn Fs_freeSpace(path: *const c_char, bytes: *mut u64) -> bool {
     no_rust_error()
 }
 
+/// Gets the size of a file in bytes.
+/// On error the size will be 0.
+/// Sets the rust error.
+#[no_mangle]
+pub extern "C" fn Fs_fileSize(path: *const c_char, bytes: *mut u64) -> bool {
+    forget_rust_error();
+    let path = path_buf_from_c_str_or_panic(unsafe_c_str(path));
+    let bytes = unsafe_mut(bytes);
+    match fs::metadata(&path) {
+        Err(err) => {
+            remember_rust_error(format!("Fs_fileSize {:?}: {}", path, err));
+            *bytes = 0;
+        }
+        Ok(metadata) => {
+            *bytes = metadata.len();
+        }
+    }
+    no_rust_error()
+}
+
 /// Checks if the path points to a directory.
 #[no_mangle]
 pub extern "C" fn Fs_isDir(path: *const c_char) -> bool {
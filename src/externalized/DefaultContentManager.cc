@@ -434,14 +434,18 @@ std::vector<ST::string> DefaultContentManager::getAllTilecache() const
 SGPFile* DefaultContentManager::openTempFileForWriting(const char* filename, bool truncate) const
 {
 	ST::string path = FileMan::joinPaths(NEW_TEMP_DIR, filename);
-	return FileMan::openForWriting(path, truncate);
+	SGPFile* const f = FileMan::openForWriting(path, truncate);
+	FileSetBufferSize(f, FILE_BUFFER_SIZE);
+	return f;
 }
 
 /** Open temporary file for appending. */
 SGPFile* DefaultContentManager::openTempFileForAppend(const char* filename) const
 {
 	ST::string path = FileMan::joinPaths(NEW_TEMP_DIR, filename);
-	return FileMan::openForAppend(path);
+	SGPFile* const f = FileMan::openForAppend(path);
+	FileSetBufferSize(f, FILE_BUFFER_SIZE);
+	return f;
 }
 
 /* Open temporary file for reading. */
@@ -456,7 +460,9 @@ SGPFile* DefaultContentManager::openTempFileForReading(const char* filename) con
 		snprintf(buf, sizeof(buf), "DefaultContentManager::openTempFileForReading: %s", err.get());
 		throw std::runtime_error(buf);
 	}
-	return FileMan::getSGPFileFromFile(file.release());
+	SGPFile* const f = FileMan::getSGPFileFromFile(file.release());
+	FileSetBufferSize(f, FILE_BUFFER_SIZE);
+	return f;
 }
 
 /** Delete temporary file. */
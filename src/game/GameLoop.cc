@@ -94,6 +94,8 @@ void    ShutdownGame(void)
 	// handle shutdown of game with respect to preloaded mapscreen graphics
 	HandleRemovalOfPreLoadedMapGraphics( );
 
+	WaitForBackgroundSave();
+
 	ShutdownJA2( );
 
 	//Save the general save game settings to disk
@@ -132,6 +134,8 @@ try
 		guiCurrentScreen = ERROR_SCREEN;
 	}
 
+	HandleBackgroundSave();
+
 
 	//if we are to check for free space on the hard drive
 	if( gfCheckForFreeSpaceOnHardDrive )
@@ -876,6 +876,7 @@ static void WriteBalanceToDisk(void)
 	// will write the current balance to disk
 	AutoSGPFile hFileHandle(GCM->openTempFileForWriting(NEWTMP_FINANCES_DATA_FILE, false));
 	FileWrite(hFileHandle, &LaptopSaveInfo.iCurrentBalance, sizeof(INT32));
+	FileFlush(hFileHandle);
 }
 
 
@@ -916,6 +917,7 @@ static void AppendFinanceToEndOfFile(void)
 	Assert(d.getConsumed() == lengthof(data));
 
 	FileWrite(f, data, sizeof(data));
+	FileFlush(f);
 }
 
 
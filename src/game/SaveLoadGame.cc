@@ -113,7 +113,11 @@
 #include <string_theory/string>
 
 #include <algorithm>
+#include <atomic>
 #include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 
 static const char g_quicksave_name[] = "QuickSave";
 static const char g_savegame_name[]  = "SaveGame";
@@ -185,8 +189,82 @@ static void SaveSoldierStructure(HWFILE hFile);
 static void SaveTacticalStatusToSavedGame(HWFILE);
 static void SaveWatchedLocsToSavedGame(HWFILE);
 
+/* Quick saves and end turn auto saves are serialized into memory and written
+ * to disk by a worker thread while the game goes on, see HandleBackgroundSave().
+ * Only one is written at a time. */
+static std::thread       g_background_save;
+static std::atomic<bool> g_background_save_done;
+static bool              g_background_save_failed;
+static UINT8             g_background_save_slot;
+
+
+static void WriteSavedGameInBackground(std::vector<uint8_t> const data, ST::string const savegame_name)
+{
+	bool failed = false;
+	// Keep the previous savegame until the new one is complete
+	ST::string const tmp_name = savegame_name + ".tmp";
+	try
+	{
+		{
+			AutoSGPFile f(FileMan::openForWriting(tmp_name));
+			FileWrite(f, data.data(), data.size());
+		}
+		FileMan::moveFile(tmp_name, savegame_name);
+	}
+	catch (...)
+	{
+		failed = true;
+		try
+		{
+			// Do not leave the partial savegame behind
+			FileDelete(tmp_name);
+		}
+		catch (...)
+		{
+		}
+	}
+	g_background_save_failed = failed;
+	g_background_save_done   = true;
+}
+
+
+static void FinishBackgroundSave(void)
+{
+	g_background_save.join();
+
+	if (g_background_save_failed)
+	{
+		ScreenMsg(FONT_MCOLOR_WHITE, MSG_INTERFACE, zSaveLoadText[SLG_SAVE_GAME_ERROR]);
+	}
+	else if (g_background_save_slot != SAVE__END_TURN_NUM && gGameOptions.ubGameSaveMode != DIF_DEAD_IS_DEAD)
+	{
+		ScreenMsg(FONT_MCOLOR_WHITE, MSG_INTERFACE, pMessageStrings[MSG_SAVESUCCESS]);
+	}
+
+	NextLoopCheckForEnoughFreeHardDriveSpace();
+}
+
+
+void HandleBackgroundSave(void)
+{
+	if (g_background_save.joinable() && g_background_save_done) FinishBackgroundSave();
+}
+
+
+void WaitForBackgroundSave(void)
+{
+	if (g_background_save.joinable()) FinishBackgroundSave();
+}
+
+
 BOOLEAN SaveGame(UINT8 ubSaveGameID, const ST::string& gameDesc)
 {
+	WaitForBackgroundSave();
+
+	bool const background = ubSaveGameID == 0 || ubSaveGameID == SAVE__END_TURN_NUM;
+	std::vector<uint8_t> snapshot;
+	char savegame_name[512];
+
 	BOOLEAN	fPausedStateBeforeSaving    = gfGamePaused;
 	BOOLEAN	fLockPauseStateBeforeSaving = gfLockPauseState;
 
@@ -258,9 +336,9 @@ BOOLEAN SaveGame(UINT8 ubSaveGameID, const ST::string& gameDesc)
 		FileMan::createDir(GCM->getSavedGamesFolder().c_str());
 
 		// Create the save game file
-		char savegame_name[512];
 		CreateSavedGameFileNameFromNumber(ubSaveGameID, savegame_name);
-		AutoSGPFile f(FileMan::openForWriting(savegame_name));
+		AutoSGPFile f(background ? FileMan::openInMemory() : FileMan::openForWriting(savegame_name));
+		FileSetBufferSize(f, FILE_BUFFER_SIZE);
 
 		/* If there are no enemy or civilians to save, we have to check BEFORE
 		 * saving the sector info struct because the
@@ -416,13 +494,16 @@ BOOLEAN SaveGame(UINT8 ubSaveGameID, const ST::string& gameDesc)
 		SaveLeaveItemList(f);
 
 		NewWayOfSavingBobbyRMailOrdersToSaveGameFile(f);
+
+		FileFlush(f);
+		if (background) snapshot = std::move(FileGetMemoryData(f));
 	}
 	catch (...)
 	{
 		if (fWePausedIt) UnPauseAfterSaveGame();
 
 		// Delete the failed attempt at saving
-		DeleteSaveGameNumber(ubSaveGameID);
+		if (!background) DeleteSaveGameNumber(ubSaveGameID);
 
 		//Put out an error message
 		ScreenMsg(FONT_MCOLOR_WHITE, MSG_INTERFACE, zSaveLoadText[SLG_SAVE_GAME_ERROR]);
@@ -441,9 +522,17 @@ BOOLEAN SaveGame(UINT8 ubSaveGameID, const ST::string& gameDesc)
 
 	SaveGameSettings();
 
-	// Display a screen message that the save was succesful (unless we are in Dead is Dead Mode to prevent message spamming)
-	if (ubSaveGameID != SAVE__END_TURN_NUM && gGameOptions.ubGameSaveMode != DIF_DEAD_IS_DEAD)
+	if (background)
+	{
+		// The success or failure is reported when the file has been written
+		g_background_save_slot   = ubSaveGameID;
+		g_background_save_done   = false;
+		g_background_save_failed = false;
+		g_background_save        = std::thread(WriteSavedGameInBackground, std::move(snapshot), ST::string(savegame_name));
+	}
+	else if (ubSaveGameID != SAVE__END_TURN_NUM && gGameOptions.ubGameSaveMode != DIF_DEAD_IS_DEAD)
 	{
+		// Display a screen message that the save was succesful (unless we are in Dead is Dead Mode to prevent message spamming)
 		ScreenMsg(FONT_MCOLOR_WHITE, MSG_INTERFACE, pMessageStrings[MSG_SAVESUCCESS]);
 	}
 
@@ -455,7 +544,7 @@ BOOLEAN SaveGame(UINT8 ubSaveGameID, const ST::string& gameDesc)
 
 	UnPauseAfterSaveGame();
 
-	NextLoopCheckForEnoughFreeHardDriveSpace();
+	if (!background) NextLoopCheckForEnoughFreeHardDriveSpace();
 	return TRUE;
 }
 
@@ -568,6 +657,8 @@ static void UpdateMercMercContractInfo(void);
 
 void LoadSavedGame(UINT8 const save_slot_id)
 {
+	WaitForBackgroundSave();
+
 	// Save the game before if we are in Dead is Dead Mode
 	if (gGameOptions.ubGameSaveMode == DIF_DEAD_IS_DEAD) {
 		// The previous options screen may be the main menu if we use quicksave/load
@@ -613,6 +704,7 @@ void LoadSavedGame(UINT8 const save_slot_id)
 	char zSaveGameName[512];
 	CreateSavedGameFileNameFromNumber(save_slot_id, zSaveGameName);
 	AutoSGPFile f(GCM->openUserPrivateFileForReading(zSaveGameName));
+	FileSetBufferSize(f, FILE_BUFFER_SIZE);
 
 	SAVED_GAME_HEADER SaveGameHeader;
 	bool stracLinuxFormat;
@@ -1301,6 +1393,8 @@ static void LoadSoldierStructure(HWFILE const f, UINT32 savegame_version, bool s
 
 void BackupSavedGame(UINT8 const ubSaveGameID)
 {
+	WaitForBackgroundSave();
+
 	ST::string backupdir = FileMan::joinPaths(GCM->getSavedGamesFolder(), "Backup");
 	FileMan::createDir(backupdir.c_str());
 	char zSourceSaveGameName[512];
@@ -1378,6 +1472,7 @@ void LoadTempFileFromSavedGame(const char* tempFileName, HWFILE const hFile)
 {
 	AutoSGPFile fileToWrite(GCM->openTempFileForWriting(tempFileName, true));
 	LoadFileFromSavedGame(fileToWrite, hFile);
+	FileFlush(fileToWrite);
 }
 
 void LoadFilesFromSavedGame(char const* const pSrcFileName, HWFILE const hFile)
@@ -80,6 +80,13 @@ void CreateSavedGameFileNameFromNumber(UINT8 ubSaveGameID, char* pzNewFileName);
 BOOLEAN SaveGame(UINT8 ubSaveGameID, const ST::string& gameDesc);
 void    LoadSavedGame(UINT8 save_slot_id);
 
+/* Reports a quick or auto save, which is written in the background, once it
+ * is on disk.  Called every frame. */
+void HandleBackgroundSave(void);
+
+// Blocks until a savegame being written in the background is on disk
+void WaitForBackgroundSave(void);
+
 void BackupSavedGame(UINT8 const ubSaveGameID);
 
 void SaveFilesToSavedGame(char const* pSrcFileName, HWFILE);
@@ -12,6 +12,7 @@
 #include "Render_Dirty.h"
 #include "Text_Input.h"
 #include "SaveLoadGame.h"
+#include "SavedGameIndex.h"
 #include "WordWrap.h"
 #include "StrategicMap.h"
 #include "Finances.h"
@@ -460,6 +461,9 @@ static void selectActiveTab()
 
 static void EnterSaveLoadScreen()
 {
+	// The slots must show the savegame still being written
+	WaitForBackgroundSave();
+
 	gfActiveTab= 0;
 	// Display Dead Is Dead games for saving by default if we are to choose the Dead is Dead Slot
 	if (guiPreviousOptionScreen == GAME_INIT_OPTIONS_SCREEN)
@@ -928,6 +932,7 @@ static void InitSaveGameArray(void)
 		SAVED_GAME_HEADER SaveGameHeader;
 		gbSaveGameArray[cnt] = LoadSavedGameHeader(cnt, &SaveGameHeader);
 	}
+	SaveSavedGameIndex();
 }
 
 
@@ -1121,15 +1126,11 @@ static BOOLEAN LoadSavedGameHeader(const INT8 bEntry, SAVED_GAME_HEADER* const h
 		char zSavedGameName[512];
 		CreateSavedGameFileNameFromNumber(gfActiveTab ? (bEntry + NUM_SAVE_GAMES) : bEntry, zSavedGameName);
 
-		try
+		if (GetSavedGameHeader(zSavedGameName, *header))
 		{
-			bool stracLinuxFormat;
-			AutoSGPFile f(GCM->openUserPrivateFileForReading(zSavedGameName));
-			ExtractSavedGameHeaderFromFile(f, *header, &stracLinuxFormat);
 			endof(header->zGameVersionNumber)[-1] =  '\0';
 			return TRUE;
 		}
-		catch (...) { /* Handled below */ }
 
 		gbSaveGameArray[bEntry] = FALSE;
 	}
@@ -1724,6 +1725,9 @@ void DoDeadIsDeadSave()
 
 void DoQuickLoad()
 {
+	// The quick save slot may still be written in the background
+	WaitForBackgroundSave();
+
 	// If there is no save in the quick save slot
 	InitSaveGameArray();
 	if (!gbSaveGameArray[0]) return;
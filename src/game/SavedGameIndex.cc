@@ -0,0 +1,187 @@
+#include "SavedGameIndex.h"
+#include "ContentManager.h"
+#include "FileMan.h"
+#include "GameInstance.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+
+// Name of the index in the savegame folder
+#define INDEX_FILE_NAME "SaveHeaders.idx"
+
+// Changes whenever the layout of the index changes
+#define INDEX_VERSION 1
+
+
+struct IndexEntry
+{
+	uint64_t          size;
+	double            modified;
+	std::vector<BYTE> header; // The start of the savegame, which holds the header
+};
+
+// The entries by the file name of the savegame
+static std::map<ST::string, IndexEntry> g_index;
+static bool                             g_index_loaded;
+static bool                             g_index_changed;
+
+
+static ST::string GetIndexPath(void)
+{
+	return FileMan::joinPaths(GCM->getSavedGamesFolder(), INDEX_FILE_NAME);
+}
+
+
+static void LoadIndex(void)
+{
+	g_index_loaded = true;
+
+	ST::string const path = GetIndexPath();
+	if (!Fs_exists(path.c_str())) return;
+
+	try
+	{
+		AutoSGPFile f(FileMan::openForReading(path));
+		FileSetBufferSize(f, FILE_BUFFER_SIZE);
+
+		UINT32 version;
+		FileRead(f, &version, sizeof(version));
+		if (version != INDEX_VERSION) return;
+
+		UINT32 n_entries;
+		FileRead(f, &n_entries, sizeof(n_entries));
+		for (UINT32 i = 0; i != n_entries; ++i)
+		{
+			UINT16 name_length;
+			FileRead(f, &name_length, sizeof(name_length));
+			std::vector<char> name(name_length);
+			FileRead(f, name.data(), name_length);
+
+			IndexEntry e;
+			UINT16     header_size;
+			FileRead(f, &e.size,       sizeof(e.size));
+			FileRead(f, &e.modified,   sizeof(e.modified));
+			FileRead(f, &header_size,  sizeof(header_size));
+			e.header.resize(header_size);
+			FileRead(f, e.header.data(), header_size);
+
+			g_index[ST::string(name.data(), name.size())] = std::move(e);
+		}
+	}
+	catch (std::exception const& e)
+	{
+		// The index is rebuilt from the savegames
+		SLOGW("Ignoring the broken savegame index: %s", e.what());
+		g_index.clear();
+	}
+}
+
+
+void SaveSavedGameIndex(void)
+{
+	if (!g_index_changed) return;
+	g_index_changed = false;
+
+	try
+	{
+		AutoSGPFile f(FileMan::openForWriting(GetIndexPath()));
+		FileSetBufferSize(f, FILE_BUFFER_SIZE);
+
+		UINT32 const version   = INDEX_VERSION;
+		UINT32 const n_entries = static_cast<UINT32>(g_index.size());
+		FileWrite(f, &version,   sizeof(version));
+		FileWrite(f, &n_entries, sizeof(n_entries));
+		for (auto const& i : g_index)
+		{
+			ST::string const& name        = i.first;
+			IndexEntry const& e           = i.second;
+			UINT16      const name_length = static_cast<UINT16>(name.size());
+			UINT16      const header_size = static_cast<UINT16>(e.header.size());
+			FileWrite(f, &name_length, sizeof(name_length));
+			FileWrite(f, name.c_str(), name_length);
+			FileWrite(f, &e.size,      sizeof(e.size));
+			FileWrite(f, &e.modified,  sizeof(e.modified));
+			FileWrite(f, &header_size, sizeof(header_size));
+			FileWrite(f, e.header.data(), header_size);
+		}
+		FileFlush(f);
+	}
+	catch (std::exception const& e)
+	{
+		SLOGW("Failed to write the savegame index: %s", e.what());
+	}
+}
+
+
+// Reads the part of the savegame which can hold the header in either format
+static std::vector<BYTE> ReadHeaderData(char const* const savegame_name)
+{
+	AutoSGPFile f(GCM->openUserPrivateFileForReading(savegame_name));
+	UINT32 const size = std::min(FileGetSize(f), static_cast<UINT32>(SAVED_GAME_HEADER_ON_DISK_SIZE_STRAC_LIN));
+	std::vector<BYTE> data(size);
+	FileRead(f, data.data(), size);
+	return data;
+}
+
+
+// Parses the header like ExtractSavedGameHeaderFromFile()
+static bool ParseHeaderData(std::vector<BYTE> const& data, SAVED_GAME_HEADER& h)
+{
+	if (data.size() >= SAVED_GAME_HEADER_ON_DISK_SIZE_STRAC_LIN)
+	{
+		ParseSavedGameHeader(data.data(), h, true);
+		if (isValidSavedGameHeader(h)) return true;
+	}
+	if (data.size() < SAVED_GAME_HEADER_ON_DISK_SIZE) return false;
+	ParseSavedGameHeader(data.data(), h, false);
+	return true;
+}
+
+
+bool GetSavedGameHeader(char const* const savegame_name, SAVED_GAME_HEADER& h)
+{
+	if (!g_index_loaded) LoadIndex();
+
+	ST::string const key = FileMan::getFileName(savegame_name);
+
+	uint64_t size;
+	double   modified;
+	if (!Fs_fileSize(savegame_name, &size) || !Fs_modifiedSecs(savegame_name, &modified))
+	{
+		// The savegame is gone
+		if (g_index.erase(key) != 0) g_index_changed = true;
+		return false;
+	}
+
+	std::map<ST::string, IndexEntry>::iterator i = g_index.find(key);
+	if (i == g_index.end() || i->second.size != size || i->second.modified != modified)
+	{
+		std::vector<BYTE> data;
+		try
+		{
+			data = ReadHeaderData(savegame_name);
+		}
+		catch (std::exception const&)
+		{
+			if (i != g_index.end())
+			{
+				g_index.erase(i);
+				g_index_changed = true;
+			}
+			return false;
+		}
+
+		IndexEntry& e = g_index[key];
+		e.size     = size;
+		e.modified = modified;
+		e.header   = std::move(data);
+		g_index_changed = true;
+		return ParseHeaderData(e.header, h);
+	}
+
+	return ParseHeaderData(i->second.header, h);
+}
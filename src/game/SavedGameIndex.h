@@ -0,0 +1,19 @@
+#ifndef SAVEDGAMEINDEX_H
+#define SAVEDGAMEINDEX_H
+
+#include "SaveLoadGame.h"
+
+
+/* The headers of the savegames are kept in an index in the savegame folder,
+ * so the save/load screen does not have to open every savegame.  An entry is
+ * only trusted while the size and modification time of its savegame match,
+ * otherwise the header is read again and the entry updated. */
+
+/* Gets the header of a savegame.  Returns false if there is no savegame or its
+ * header cannot be read. */
+bool GetSavedGameHeader(char const* savegame_name, SAVED_GAME_HEADER&);
+
+// Writes the index if any entry changed since it was last written
+void SaveSavedGameIndex(void);
+
+#endif
@@ -5587,10 +5587,11 @@ static void RepositionMouseRegions(void)
 	for (UINT32 i = 0; i < GetNumberOfLinesOfTextInBox(ghAssignmentBox); ++i)
 	{
 		MOUSE_REGION* const r = &gAssignmentMenuRegion[i];
-		r->RegionTopLeftX     += sDeltaX;
-		r->RegionTopLeftY     += sDeltaY;
-		r->RegionBottomRightX += sDeltaX;
-		r->RegionBottomRightY += sDeltaY;
+		MSYS_MoveRegion(r,
+			r->RegionTopLeftX     + sDeltaX,
+			r->RegionTopLeftY     + sDeltaY,
+			r->RegionBottomRightX + sDeltaX,
+			r->RegionBottomRightY + sDeltaY);
 	}
 
 	gfPausedTacticalRenderFlags = TRUE;
@@ -0,0 +1,105 @@
+#include "AutoResolveSimulation.h"
+#include "Auto_Resolve.h"
+#include "Campaign_Types.h"
+#include "Game_Init.h"
+#include "Init.h"
+#include "PreBattle_Interface.h"
+#include "Queen_Command.h"
+#include "Random.h"
+#include "ScreenIDs.h"
+#include "StrategicMap.h"
+#include "Timer_Control.h"
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// Militia put into the sector when it has none, so the enemies have someone to fight
+#define SIMULATION_MILITIA 10
+
+
+typedef std::chrono::steady_clock SimulationClock;
+
+
+static void HashBytes(UINT32& hash, void const* const data, size_t const size)
+{
+	// FNV-1a
+	UINT8 const* const bytes = static_cast<UINT8 const*>(data);
+	for (size_t i = 0; i != size; ++i)
+	{
+		hash ^= bytes[i];
+		hash *= 16777619U;
+	}
+}
+
+
+int RunAutoResolveSimulation(char const* const sector, UINT32 const battles, UINT32 const seed)
+{
+	INT16 x;
+	INT16 y;
+	if (!ParseSectorID(sector, &x, &y))
+	{
+		fprintf(stderr, "Invalid autoresolve simulation sector '%s'\n", sector);
+		return EXIT_FAILURE;
+	}
+	if (battles == 0)
+	{
+		fprintf(stderr, "The autoresolve simulation needs at least one battle\n");
+		return EXIT_FAILURE;
+	}
+
+	ShutdownJA2Clock();
+	InitializeRandom(seed);
+
+	if (InitializeJA2() == ERROR_SCREEN) return EXIT_FAILURE;
+	InitNewGame();
+
+	if (NumEnemiesInSector(x, y) == 0)
+	{
+		fprintf(stderr, "There are no enemies in sector %s\n", sector);
+		return EXIT_FAILURE;
+	}
+
+	SECTORINFO& info = SectorInfo[SECTOR(x, y)];
+	if (info.ubNumberOfCivsAtLevel[GREEN_MILITIA] + info.ubNumberOfCivsAtLevel[REGULAR_MILITIA] + info.ubNumberOfCivsAtLevel[ELITE_MILITIA] == 0)
+	{
+		info.ubNumberOfCivsAtLevel[REGULAR_MILITIA] = SIMULATION_MILITIA;
+	}
+	// Militia never attack, they defend the sector against the enemies
+	gubEnemyEncounterCode = ENEMY_INVASION_CODE;
+
+	UINT32   victories     = 0;
+	uint64_t alive_player  = 0;
+	uint64_t alive_enemies = 0;
+	uint64_t battle_time   = 0;
+	UINT32   checksum      = 2166136261U;
+	SimulationClock::time_point const start = SimulationClock::now();
+
+	for (UINT32 i = 0; i != battles; ++i)
+	{
+		InitializeRandom(seed + i);
+		AutoResolveResult const r = ResolveBattleHeadless(x, y);
+		if (r.fVictory) ++victories;
+		alive_player  += r.ubAlivePlayer;
+		alive_enemies += r.ubAliveEnemies;
+		battle_time   += r.uiBattleTime;
+		HashBytes(checksum, &r.fVictory,       sizeof(r.fVictory));
+		HashBytes(checksum, &r.ubAlivePlayer,  sizeof(r.ubAlivePlayer));
+		HashBytes(checksum, &r.ubAliveEnemies, sizeof(r.ubAliveEnemies));
+		HashBytes(checksum, &r.uiBattleTime,   sizeof(r.uiBattleTime));
+	}
+
+	typedef std::chrono::duration<double, std::milli> Millis;
+	double const wall = Millis(SimulationClock::now() - start).count();
+
+	printf("Autoresolve simulation: %u battles in %s, seeds %u to %u\n", battles, sector, seed, seed + battles - 1);
+	printf("  player victories  %.1f%%\n", 100.0 * victories / battles);
+	printf("  alive player      %.2f\n", double(alive_player) / battles);
+	printf("  alive enemies     %.2f\n", double(alive_enemies) / battles);
+	printf("  battle length     %.1f s of game time\n", double(battle_time) / battles / 1000);
+	printf("  wall time         %.1f ms, %.3f ms/battle\n", wall, wall / battles);
+	printf("  checksum          %08X\n", checksum);
+	return EXIT_SUCCESS;
+}
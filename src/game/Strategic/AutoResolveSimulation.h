@@ -0,0 +1,13 @@
+#ifndef AUTORESOLVESIMULATION_H
+#define AUTORESOLVESIMULATION_H
+
+#include "Types.h"
+
+
+/* Headless autoresolve simulation (see -autoresolvesim).  The battle in the
+ * sector (e.g. "D13") of a new game is fought `battles` times, battle i with
+ * the random generators seeded with `seed` + i, and the outcome statistics and
+ * timings are printed.  Returns the exit code for the executable. */
+int RunAutoResolveSimulation(char const* sector, UINT32 battles, UINT32 seed);
+
+#endif
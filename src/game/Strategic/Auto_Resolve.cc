@@ -176,6 +176,7 @@ struct AUTORESOLVE_STRUCT
 	BOOLEAN fEnteringAutoResolve;
 	BOOLEAN fMoraleEventsHandled;
 	BOOLEAN fCaptureNotPermittedDueToEPCs;
+	BOOLEAN fHeadless; // simulated without the interface, see ResolveBattleHeadless()
 
 	MOUSE_REGION AutoResolveRegion;
 };
@@ -429,13 +430,8 @@ static void DoTransitionFromPreBattleInterfaceToAutoResolve(void)
 	}
 }
 
-void EnterAutoResolveMode( UINT8 ubSectorX, UINT8 ubSectorY )
+static void AllocateAutoResolve(UINT8 const ubSectorX, UINT8 const ubSectorY)
 {
-	//Set up mapscreen for removal
-	SetPendingNewScreen( AUTORESOLVE_SCREEN );
-	CreateDestroyMapInvButton();
-	RenderButtons();
-
 	//Allocate memory for all the globals while we are in this mode.
 	gpAR = new AUTORESOLVE_STRUCT{};
 	//Mercs -- 20 max
@@ -476,6 +472,17 @@ void EnterAutoResolveMode( UINT8 ubSectorX, UINT8 ubSectorY )
 }
 
 
+void EnterAutoResolveMode( UINT8 ubSectorX, UINT8 ubSectorY )
+{
+	//Set up mapscreen for removal
+	SetPendingNewScreen( AUTORESOLVE_SCREEN );
+	CreateDestroyMapInvButton();
+	RenderButtons();
+
+	AllocateAutoResolve(ubSectorX, ubSectorY);
+}
+
+
 static void CalculateAttackValues(void);
 static void CalculateAutoResolveInfo(void);
 static void CalculateSoldierCells(BOOLEAN fReset);
@@ -702,7 +709,7 @@ static void CalculateSoldierCells(BOOLEAN fReset)
 				}
 			}
 			SOLDIERCELL& c = gpMercs[index];
-			c.pRegion = new MouseRegion(c.xp, c.yp, 50, 44, MSYS_PRIORITY_HIGH, 0, MercCellMouseMoveCallback, MercCellMouseClickCallback);
+			if (!gpAR->fHeadless) c.pRegion = new MouseRegion(c.xp, c.yp, 50, 44, MSYS_PRIORITY_HIGH, 0, MercCellMouseMoveCallback, MercCellMouseClickCallback);
 			if( fReset )
 				RefreshMerc( gpMercs[ index ].pSoldier );
 			if( !gpMercs[ index ].pSoldier->bLife )
@@ -1501,53 +1508,11 @@ static void RejectSurrenderCallback(GUI_BUTTON* btn, INT32 reason);
 static void RetreatButtonCallback(GUI_BUTTON* btn, INT32 reason);
 
 
-static void CreateAutoResolveInterface(void)
+// Creates the militia and the enemies fighting in the battle
+static void CreateAutoResolveSoldiers(void)
 {
 	AUTORESOLVE_STRUCT* const ar = gpAR;
 
-	// Setup new autoresolve blanket interface.
-	MSYS_DefineRegion(&ar->AutoResolveRegion, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, MSYS_PRIORITY_HIGH - 1, 0, MSYS_NO_CALLBACK, MSYS_NO_CALLBACK);
-	ar->fRenderAutoResolve = TRUE;
-	ar->fExitAutoResolve   = FALSE;
-
-	//Load the general panel image pieces, to be combined to make the dynamically sized window.
-	ar->iPanelImages = AddVideoObjectFromFile(INTERFACEDIR "/autoresolve.sti");
-
-	// Load the button images file, and assign it to the first button.
-	BUTTON_PICS* const btn_pics = LoadButtonImage(INTERFACEDIR "/autobtns.sti", 0, 7);
-	ar->iButtonImage[PAUSE_BUTTON]    = btn_pics;
-	// Have the other buttons hook into the first button containing the images.
-	ar->iButtonImage[PLAY_BUTTON]     = UseLoadedButtonImage(btn_pics,  1,  8);
-	ar->iButtonImage[FAST_BUTTON]     = UseLoadedButtonImage(btn_pics,  2,  9);
-	ar->iButtonImage[FINISH_BUTTON]   = UseLoadedButtonImage(btn_pics,  3, 10);
-	ar->iButtonImage[YES_BUTTON]      = UseLoadedButtonImage(btn_pics,  4, 11);
-	ar->iButtonImage[NO_BUTTON]       = UseLoadedButtonImage(btn_pics,  5, 12);
-	ar->iButtonImage[BANDAGE_BUTTON]  = UseLoadedButtonImage(btn_pics,  6, 13);
-	ar->iButtonImage[RETREAT_BUTTON]  = UseLoadedButtonImage(btn_pics, 14, 15);
-	ar->iButtonImage[DONEWIN_BUTTON]  = UseLoadedButtonImage(btn_pics, 14, 15);
-	ar->iButtonImage[DONELOSE_BUTTON] = UseLoadedButtonImage(btn_pics, 16, 17);
-
-	// Load the generic faces for civs and enemies
-	SGPVObject* const faces = AddVideoObjectFromFile(INTERFACEDIR "/smfaces.sti");
-	ar->iFaces = faces;
-	SGPPaletteEntry const* const pal = faces->Palette();
-	faces->pShades[0] = Create16BPPPaletteShaded(pal, 255, 255, 255, FALSE);
-	faces->pShades[1] = Create16BPPPaletteShaded(pal, 250,  25,  25, TRUE);
-
-	// Add the battle over panels
-	ar->iIndent = AddVideoObjectFromFile(INTERFACEDIR "/indent.sti");
-
-	// Add all the faces now
-	FOR_EACH_AR_MERC(cell)
-	{
-		//Load the face
-		SGPVObject* const face = Load65Portrait(GetProfile(cell->pSoldier->ubProfile));
-		cell->uiVObjectID = face;
-		SGPPaletteEntry const* const pal = face->Palette();
-		face->pShades[0] = Create16BPPPaletteShaded(pal, 255, 255, 255, FALSE);
-		face->pShades[1] = Create16BPPPaletteShaded(pal, 250,  25,  25, TRUE);
-	}
-
 	UINT8 n_militia_elite = MilitiaInSectorOfRank(ar->ubSectorX, ar->ubSectorY, ELITE_MILITIA);
 	UINT8 n_militia_reg   = MilitiaInSectorOfRank(ar->ubSectorX, ar->ubSectorY, REGULAR_MILITIA);
 	UINT8 n_militia_green = MilitiaInSectorOfRank(ar->ubSectorX, ar->ubSectorY, GREEN_MILITIA);
@@ -1615,6 +1580,57 @@ static void CreateAutoResolveInterface(void)
 		cell = MakeCreatures(cell, ar->ubYFCreatures, ar, YAF_MONSTER,        YF_CREATURE_FACE);
 		cell = MakeCreatures(cell, ar->ubYMCreatures, ar, YAM_MONSTER,        YM_CREATURE_FACE);
 	}
+}
+
+
+static void CreateAutoResolveInterface(void)
+{
+	AUTORESOLVE_STRUCT* const ar = gpAR;
+
+	// Setup new autoresolve blanket interface.
+	MSYS_DefineRegion(&ar->AutoResolveRegion, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, MSYS_PRIORITY_HIGH - 1, 0, MSYS_NO_CALLBACK, MSYS_NO_CALLBACK);
+	ar->fRenderAutoResolve = TRUE;
+	ar->fExitAutoResolve   = FALSE;
+
+	//Load the general panel image pieces, to be combined to make the dynamically sized window.
+	ar->iPanelImages = AddVideoObjectFromFile(INTERFACEDIR "/autoresolve.sti");
+
+	// Load the button images file, and assign it to the first button.
+	BUTTON_PICS* const btn_pics = LoadButtonImage(INTERFACEDIR "/autobtns.sti", 0, 7);
+	ar->iButtonImage[PAUSE_BUTTON]    = btn_pics;
+	// Have the other buttons hook into the first button containing the images.
+	ar->iButtonImage[PLAY_BUTTON]     = UseLoadedButtonImage(btn_pics,  1,  8);
+	ar->iButtonImage[FAST_BUTTON]     = UseLoadedButtonImage(btn_pics,  2,  9);
+	ar->iButtonImage[FINISH_BUTTON]   = UseLoadedButtonImage(btn_pics,  3, 10);
+	ar->iButtonImage[YES_BUTTON]      = UseLoadedButtonImage(btn_pics,  4, 11);
+	ar->iButtonImage[NO_BUTTON]       = UseLoadedButtonImage(btn_pics,  5, 12);
+	ar->iButtonImage[BANDAGE_BUTTON]  = UseLoadedButtonImage(btn_pics,  6, 13);
+	ar->iButtonImage[RETREAT_BUTTON]  = UseLoadedButtonImage(btn_pics, 14, 15);
+	ar->iButtonImage[DONEWIN_BUTTON]  = UseLoadedButtonImage(btn_pics, 14, 15);
+	ar->iButtonImage[DONELOSE_BUTTON] = UseLoadedButtonImage(btn_pics, 16, 17);
+
+	// Load the generic faces for civs and enemies
+	SGPVObject* const faces = AddVideoObjectFromFile(INTERFACEDIR "/smfaces.sti");
+	ar->iFaces = faces;
+	SGPPaletteEntry const* const pal = faces->Palette();
+	faces->pShades[0] = Create16BPPPaletteShaded(pal, 255, 255, 255, FALSE);
+	faces->pShades[1] = Create16BPPPaletteShaded(pal, 250,  25,  25, TRUE);
+
+	// Add the battle over panels
+	ar->iIndent = AddVideoObjectFromFile(INTERFACEDIR "/indent.sti");
+
+	// Add all the faces now
+	FOR_EACH_AR_MERC(cell)
+	{
+		//Load the face
+		SGPVObject* const face = Load65Portrait(GetProfile(cell->pSoldier->ubProfile));
+		cell->uiVObjectID = face;
+		SGPPaletteEntry const* const pal = face->Palette();
+		face->pShades[0] = Create16BPPPaletteShaded(pal, 255, 255, 255, FALSE);
+		face->pShades[1] = Create16BPPPaletteShaded(pal, 250,  25,  25, TRUE);
+	}
+
+	CreateAutoResolveSoldiers();
 
 	if (ar->ubSectorX  == gWorldSectorX &&
 			ar->ubSectorY  == gWorldSectorY &&
@@ -3533,7 +3549,7 @@ static BOOLEAN IsBattleOver(void)
 	{
 		return FALSE;
 	}
-	SetupDoneInterface();
+	if (!gpAR->fHeadless) SetupDoneInterface();
 	return TRUE;
 }
 
@@ -3789,7 +3805,7 @@ static void ProcessBattleFrame(void)
 				return;
 			}
 			CONTINUE_BATTLE:
-			if( IsBattleOver() || (gubEnemyEncounterCode != CREATURE_ATTACK_CODE && AttemptPlayerCapture()) )
+			if( IsBattleOver() || (gubEnemyEncounterCode != CREATURE_ATTACK_CODE && !gpAR->fHeadless && AttemptPlayerCapture()) )
 				return;
 
 			iRandom = PreRandom( iTotal );
@@ -3911,6 +3927,60 @@ static void ProcessBattleFrame(void)
 }
 
 
+AutoResolveResult ResolveBattleHeadless(UINT8 const x, UINT8 const y)
+{
+	AllocateAutoResolve(x, y);
+	AUTORESOLVE_STRUCT& ar = *gpAR;
+	ar.fHeadless = TRUE;
+	ar.fSound    = FALSE;
+
+	CalculateAutoResolveInfo();
+	CalculateSoldierCells(FALSE);
+	CreateAutoResolveSoldiers();
+	DetermineTeamLeader(TRUE);
+	DetermineTeamLeader(FALSE);
+	CalculateAttackValues();
+
+	// Same as the finish button, so the whole battle is fought in one frame
+	ar.uiTimeSlice    = 0xffffffff;
+	ar.fInstantFinish = TRUE;
+	ar.uiCurrTime     = 1;
+	while (ar.ubBattleStatus == BATTLE_IN_PROGRESS)
+	{
+		ProcessBattleFrame();
+	}
+
+	AutoResolveResult result;
+	result.fVictory       = ar.ubBattleStatus == BATTLE_VICTORY;
+	result.ubAlivePlayer  = ar.ubAliveMercs + ar.ubAliveCivs;
+	result.ubAliveEnemies = ar.ubAliveEnemies;
+	result.uiBattleTime   = ar.uiTotalElapsedBattleTimeInMilliseconds;
+
+	for (INT32 i = 0; i != ar.ubCivs; ++i)
+	{
+		if (gpCivs[i].pSoldier) TacticalRemoveSoldier(*gpCivs[i].pSoldier);
+	}
+	for (INT32 i = 0; i != 32; ++i)
+	{
+		if (gpEnemies[i].pSoldier) TacticalRemoveSoldier(*gpEnemies[i].pSoldier);
+	}
+
+	delete gpAR;
+	gpAR = 0;
+
+	delete[] gpMercs;
+	gpMercs = 0;
+
+	delete[] gpCivs;
+	gpCivs = 0;
+
+	delete[] gpEnemies;
+	gpEnemies = 0;
+
+	return result;
+}
+
+
 BOOLEAN IsAutoResolveActive()
 {
 	//is the autoresolve up or not?
@@ -29,4 +29,17 @@ BOOLEAN GetCurrentBattleSectorXYZAndReturnTRUEIfThereIsABattle(INT16* psSectorX,
 
 ScreenID AutoResolveScreenHandle(void);
 
+struct AutoResolveResult
+{
+	BOOLEAN fVictory;
+	UINT8   ubAlivePlayer;  // mercs and militia
+	UINT8   ubAliveEnemies;
+	UINT32  uiBattleTime;   // in milliseconds of game time
+};
+
+/* Fights the battle in the sector to the end, without the interface and
+ * without applying the outcome to the campaign (involved mercs do get hurt,
+ * though).  The result depends only on the state of the random generators. */
+AutoResolveResult ResolveBattleHeadless(UINT8 x, UINT8 y);
+
 #endif
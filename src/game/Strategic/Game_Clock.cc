@@ -30,6 +30,8 @@
 #include "ScreenIDs.h"
 #include "FileMan.h"
 #include "UILayout.h"
+#include "GameLoop.h"
+#include "MessageBoxScreen.h"
 
 #include <string_theory/format>
 #include <string_theory/string>
@@ -66,6 +68,11 @@ static MOUSE_REGION gClockScreenMaskMouseRegion;
 #define CLOCK_WIDTH   66
 #define CLOCK_FONT   COMPFONT
 
+// In throughput mode the top compression rate advances the clock in windows of
+// this many game seconds, as many as fit into the budget of a frame
+#define THROUGHPUT_WINDOW       NUM_SEC_IN_HOUR
+#define THROUGHPUT_FRAME_BUDGET 30 // ms of real time per frame
+
 
 //These contain all of the information about the game time, rate of time, etc.
 //All of these get saved and loaded.
@@ -92,6 +99,9 @@ BOOLEAN        gfLockPauseState = FALSE;
 BOOLEAN        gfPauseDueToPlayerGamePause = FALSE;
 BOOLEAN        gfResetAllPlayerKnowsEnemiesFlags = FALSE;
 static BOOLEAN gfTimeCompressionOn = FALSE;
+static BOOLEAN gfTimeCompressionThroughput = FALSE;
+static UINT32  guiThroughputGameSeconds = 0;
+static UINT32  guiThroughputRealTime = 0;
 UINT32         guiLockPauseStateLastReasonId = 0;
 //***When adding new saved time variables, make sure you remove the appropriate amount from the paddingbytes and
 //   more IMPORTANTLY, add appropriate code in Save/LoadGameClock()!
@@ -495,6 +505,61 @@ static void SetClockResolutionToCompressMode(INT32 iCompressMode)
 
 
 
+static void ReportTimeCompressionThroughput(void)
+{
+	if (guiThroughputRealTime == 0) return;
+	SLOGI("Time compression throughput: %u game hours in %u ms, %.1f game hours per second",
+		guiThroughputGameSeconds / NUM_SEC_IN_HOUR, guiThroughputRealTime,
+		guiThroughputGameSeconds / (3.6f * guiThroughputRealTime));
+	guiThroughputGameSeconds = 0;
+	guiThroughputRealTime    = 0;
+}
+
+
+void SetTimeCompressionThroughput(BOOLEAN const fThroughput)
+{
+	if (!fThroughput) ReportTimeCompressionThroughput();
+	gfTimeCompressionThroughput = fThroughput;
+}
+
+
+BOOLEAN IsTimeCompressionThroughputOn(void)
+{
+	return gfTimeCompressionThroughput;
+}
+
+
+// Stops at anything that needs to be shown to the player before time goes on
+static bool CanContinueThroughput(void)
+{
+	return
+		IsTimeBeingCompressed() &&
+		!gfTimeInterrupt &&
+		!gfTimeInterruptPause &&
+		!(gTacticalStatus.uiFlags & INCOMBAT) &&
+		!gfInMsgBox &&
+		guiPendingScreen == NO_PENDING_SCREEN;
+}
+
+
+/* Advances the clock window after window until the frame budget is used up, so
+ * the screen is only rendered once per frame instead of once per window. */
+static void AdvanceClockInWindows(void)
+{
+	UINT32 const uiStart     = GetJA2Clock();
+	UINT32 const uiStartTime = guiGameClock;
+	do
+	{
+		WarpGameTime(THROUGHPUT_WINDOW, WARPTIME_PROCESS_EVENTS_NORMALLY);
+	}
+	while (CanContinueThroughput() && GetJA2Clock() - uiStart < THROUGHPUT_FRAME_BUDGET);
+
+	guiThroughputGameSeconds += guiGameClock - uiStartTime;
+	guiThroughputRealTime    += GetJA2Clock() - uiStart;
+	if (!CanContinueThroughput()) ReportTimeCompressionThroughput();
+}
+
+
 void SetGameHoursPerSecond( UINT32 uiGameHoursPerSecond )
 {
 	giTimeCompressMode = NOT_USING_TIME_COMPRESSION;
@@ -651,6 +716,14 @@ void UpdateClock()
 
 	uiNewTime = GetJA2Clock();
 
+	if (gfTimeCompressionThroughput && giTimeCompressMode == TIME_COMPRESS_60MINS && gfTimeCompressionOn)
+	{
+		AdvanceClockInWindows();
+		uiLastSecondTime = uiNewTime;
+		guiTimesThisSecondProcessed = uiLastTimeProcessed = 0;
+		return;
+	}
+
 #ifdef DEBUG_GAME_CLOCK
 	uiOrigNewTime = uiNewTime;
 	uiOrigLastSecondTime = uiLastSecondTime;
@@ -71,6 +71,12 @@ void StartTimeCompression( void );
 BOOLEAN IsTimeBeingCompressed( void );	// returns FALSE if time isn't currently being compressed for ANY reason (various pauses, etc.)
 BOOLEAN IsTimeCompressionOn( void );		// returns TRUE if the player currently wants time to be compressing
 
+/* In throughput mode the top compression rate runs as fast as the strategic
+ * simulation allows instead of at one game hour per second.  The achieved
+ * game hours per real second are logged whenever it stops. */
+void SetTimeCompressionThroughput(BOOLEAN fThroughput);
+BOOLEAN IsTimeCompressionThroughputOn(void);
+
 //USING TIME COMPRESSION
 //Allows the setting/changing/access of time rate via predefined compression values.
 //These functions change the index in giTimeCompressSpeeds which aren't in any
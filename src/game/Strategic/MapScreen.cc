@@ -2993,6 +2993,12 @@ static void HandleModShift(UINT const key)
 			SelectAllCharactersInSquad(squad_no);
 			break;
 		}
+
+		case '+':
+		case '=':
+			SetTimeCompressionThroughput(!IsTimeCompressionThroughputOn());
+			SLOGI("Time compression throughput mode %s", IsTimeCompressionThroughputOn() ? "enabled" : "disabled");
+			break;
 	}
 }
 
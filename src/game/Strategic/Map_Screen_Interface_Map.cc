@@ -52,6 +52,7 @@
 #include "Video.h"
 
 #include <stdexcept>
+#include <string.h>
 #include <string_theory/format>
 #include <string_theory/string>
 
@@ -278,6 +279,33 @@ enum{
 // the big map .pcx
 static SGPVSurface* guiBIGMAP;
 
+/* Cached map background with the sector shading, the bottom layer of the map.
+ * The key holds everything the layer is drawn from. */
+struct MapTerrainKey
+{
+	BOOLEAN zoom;
+	INT32   zoom_x;
+	INT32   zoom_y;
+	BOOLEAN airspace;
+	UINT8   visited[256 / 8];   // one bit per sector
+	UINT8   enemy_air[256 / 8];
+
+	bool operator ==(MapTerrainKey const& o) const
+	{
+		return
+			zoom     == o.zoom     &&
+			zoom_x   == o.zoom_x   &&
+			zoom_y   == o.zoom_y   &&
+			airspace == o.airspace &&
+			memcmp(visited,   o.visited,   sizeof(visited))   == 0 &&
+			memcmp(enemy_air, o.enemy_air, sizeof(enemy_air)) == 0;
+	}
+};
+
+static SGPVSurface*  guiMapTerrainLayer;
+static MapTerrainKey gMapTerrainKey;
+static BOOLEAN       gfMapTerrainLayerValid = FALSE;
+
 // orta .sti icon
 static SGPVObject* guiORTAICON;
 static SGPVObject* guiTIXAICON;
@@ -587,81 +615,158 @@ static void ShowTeamAndVehicles();
 static void ShowTownText(void);
 
 
-void DrawMap(void)
+// Returns the part of the save buffer the map background covers
+static SGPBox GetMapTerrainBox(void)
 {
-	if (!iCurrentMapSectorZ)
+	if (fZoomFlag)
 	{
-		if (fZoomFlag)
+		UINT16 const x     = iZoomX - 2;
+		UINT16 const y     = iZoomY - 3;
+		UINT16 const src_w = guiBIGMAP->Width();
+		UINT16 const src_h = guiBIGMAP->Height();
+		SGPBox const box =
 		{
-			if (iZoomX < WEST_ZOOM_BOUND)      iZoomX = WEST_ZOOM_BOUND;
-			if (iZoomX > EAST_ZOOM_BOUND)      iZoomX = EAST_ZOOM_BOUND;
-			if (iZoomY < NORTH_ZOOM_BOUND + 1) iZoomY = NORTH_ZOOM_BOUND;
-			if (iZoomY > SOUTH_ZOOM_BOUND)     iZoomY = SOUTH_ZOOM_BOUND;
-
-			UINT16 const  x     = iZoomX - 2;
-			UINT16 const  y     = iZoomY - 3;
-			UINT16        w     = MAP_VIEW_WIDTH  + 2;
-			UINT16        h     = MAP_VIEW_HEIGHT - 1;
-			UINT16 const src_w = guiBIGMAP->Width();
-			UINT16 const src_h = guiBIGMAP->Height();
-			if (w > src_w - x) w = src_w - x;
-			if (h > src_h - y) h = src_h - y;
-			SGPBox const clip = { x, y, w, h };
-			BltVideoSurface(guiSAVEBUFFER, guiBIGMAP, MAP_VIEW_START_X + MAP_GRID_X, MAP_VIEW_START_Y + MAP_GRID_Y - 2, &clip);
-		}
-		else
+			(UINT16)(MAP_VIEW_START_X + MAP_GRID_X),
+			(UINT16)(MAP_VIEW_START_Y + MAP_GRID_Y - 2),
+			(UINT16)MIN(MAP_VIEW_WIDTH  + 2, src_w - x),
+			(UINT16)MIN(MAP_VIEW_HEIGHT - 1, src_h - y)
+		};
+		return box;
+	}
+	else
+	{
+		SGPBox const box =
 		{
-			BltVideoSurfaceHalf(guiSAVEBUFFER, guiBIGMAP, MAP_VIEW_START_X + 1, MAP_VIEW_START_Y, NULL);
-		}
+			(UINT16)(MAP_VIEW_START_X + 1),
+			(UINT16)MAP_VIEW_START_Y,
+			(UINT16)(guiBIGMAP->Width()  / 2),
+			(UINT16)(guiBIGMAP->Height() / 2)
+		};
+		return box;
+	}
+}
+
 
-		// shade map sectors (must be done after Tixa/Orta/Mine icons have been blitted, but before icons!)
-		for (INT16 cnt = 1; cnt < MAP_WORLD_X - 1; ++cnt)
+// Draws the map background and the sector shading into the save buffer
+static void DrawMapTerrain(void)
+{
+	SGPBox const box = GetMapTerrainBox();
+	if (fZoomFlag)
+	{
+		SGPBox const clip = { (UINT16)(iZoomX - 2), (UINT16)(iZoomY - 3), box.w, box.h };
+		BltVideoSurface(guiSAVEBUFFER, guiBIGMAP, box.x, box.y, &clip);
+	}
+	else
+	{
+		BltVideoSurfaceHalf(guiSAVEBUFFER, guiBIGMAP, box.x, box.y, NULL);
+	}
+
+	// shade map sectors (must be done after Tixa/Orta/Mine icons have been blitted, but before icons!)
+	for (INT16 cnt = 1; cnt < MAP_WORLD_X - 1; ++cnt)
+	{
+		for (INT16 cnt2 = 1; cnt2 < MAP_WORLD_Y - 1; ++cnt2)
 		{
-			for (INT16 cnt2 = 1; cnt2 < MAP_WORLD_Y - 1; ++cnt2)
+			if (!GetSectorFlagStatus(cnt, cnt2, iCurrentMapSectorZ, SF_ALREADY_VISITED))
 			{
-				if (!GetSectorFlagStatus(cnt, cnt2, iCurrentMapSectorZ, SF_ALREADY_VISITED))
+				INT32 color;
+				if (fShowAircraftFlag)
 				{
-					INT32 color;
-					if (fShowAircraftFlag)
+					if (!StrategicMap[cnt + cnt2 * WORLD_MAP_X].fEnemyAirControlled)
 					{
-						if (!StrategicMap[cnt + cnt2 * WORLD_MAP_X].fEnemyAirControlled)
-						{
-							// sector not visited, not air controlled
-							color = MAP_SHADE_DK_GREEN;
-						}
-						else
-						{
-							// sector not visited, controlled and air not
-							color = MAP_SHADE_DK_RED;
-						}
+						// sector not visited, not air controlled
+						color = MAP_SHADE_DK_GREEN;
 					}
 					else
 					{
-						// not visited
-						color = MAP_SHADE_BLACK;
+						// sector not visited, controlled and air not
+						color = MAP_SHADE_DK_RED;
 					}
-					ShadeMapElem(cnt, cnt2, color);
 				}
 				else
 				{
-					if (fShowAircraftFlag)
+					// not visited
+					color = MAP_SHADE_BLACK;
+				}
+				ShadeMapElem(cnt, cnt2, color);
+			}
+			else
+			{
+				if (fShowAircraftFlag)
+				{
+					INT32 color;
+					if (!StrategicMap[cnt + cnt2 * WORLD_MAP_X].fEnemyAirControlled)
+					{
+						// sector visited and air controlled
+						color = MAP_SHADE_LT_GREEN;
+					}
+					else
 					{
-						INT32 color;
-						if (!StrategicMap[cnt + cnt2 * WORLD_MAP_X].fEnemyAirControlled)
-						{
-							// sector visited and air controlled
-							color = MAP_SHADE_LT_GREEN;
-						}
-						else
-						{
-							// sector visited but not air controlled
-							color = MAP_SHADE_LT_RED;
-						}
-						ShadeMapElem(cnt, cnt2, color);
+						// sector visited but not air controlled
+						color = MAP_SHADE_LT_RED;
 					}
+					ShadeMapElem(cnt, cnt2, color);
 				}
 			}
 		}
+	}
+}
+
+
+static MapTerrainKey GetMapTerrainKey(void)
+{
+	MapTerrainKey key;
+	memset(&key, 0, sizeof(key));
+	key.zoom     = fZoomFlag;
+	key.zoom_x   = iZoomX;
+	key.zoom_y   = iZoomY;
+	key.airspace = fShowAircraftFlag;
+	for (INT16 y = 1; y < MAP_WORLD_Y - 1; ++y)
+	{
+		for (INT16 x = 1; x < MAP_WORLD_X - 1; ++x)
+		{
+			UINT8 const sector = SECTOR(x, y);
+			UINT8 const bit    = 1 << (sector % 8);
+			if (GetSectorFlagStatus(x, y, 0, SF_ALREADY_VISITED))        key.visited[sector / 8]   |= bit;
+			if (StrategicMap[x + y * WORLD_MAP_X].fEnemyAirControlled) key.enemy_air[sector / 8] |= bit;
+		}
+	}
+	return key;
+}
+
+
+/* The terrain layer is only drawn again when its inputs changed, otherwise the
+ * cached copy is blitted back. */
+static void RenderMapTerrainLayer(void)
+{
+	SGPBox        const box = GetMapTerrainBox();
+	MapTerrainKey const key = GetMapTerrainKey();
+	if (gfMapTerrainLayerValid && key == gMapTerrainKey)
+	{
+		SGPBox const src = { 0, 0, box.w, box.h };
+		BltVideoSurface(guiSAVEBUFFER, guiMapTerrainLayer, box.x, box.y, &src);
+		return;
+	}
+
+	DrawMapTerrain();
+	BltVideoSurface(guiMapTerrainLayer, guiSAVEBUFFER, 0, 0, &box);
+	gMapTerrainKey         = key;
+	gfMapTerrainLayerValid = TRUE;
+}
+
+
+void DrawMap(void)
+{
+	if (!iCurrentMapSectorZ)
+	{
+		if (fZoomFlag)
+		{
+			if (iZoomX < WEST_ZOOM_BOUND)      iZoomX = WEST_ZOOM_BOUND;
+			if (iZoomX > EAST_ZOOM_BOUND)      iZoomX = EAST_ZOOM_BOUND;
+			if (iZoomY < NORTH_ZOOM_BOUND + 1) iZoomY = NORTH_ZOOM_BOUND;
+			if (iZoomY > SOUTH_ZOOM_BOUND)     iZoomY = SOUTH_ZOOM_BOUND;
+		}
+
+		RenderMapTerrainLayer();
 
 		/* unfortunately, we can't shade these icons as part of shading the map,
 		 * because for airspace, the shade function doesn't merely shade the
@@ -3663,6 +3768,11 @@ static void DropAPersonInASector(UINT8 const type, UINT8 const sector)
 void LoadMapScreenInterfaceMapGraphics()
 {
 	guiBIGMAP                      = AddVideoSurfaceFromFile(INTERFACEDIR "/b_map.pcx");
+	guiMapTerrainLayer             = AddVideoSurface(
+		MAX(guiBIGMAP->Width()  / 2, MAP_VIEW_WIDTH  + 2),
+		MAX(guiBIGMAP->Height() / 2, MAP_VIEW_HEIGHT - 1),
+		PIXEL_DEPTH);
+	gfMapTerrainLayerValid         = FALSE;
 	guiBULLSEYE                    = AddVideoObjectFromFile(INTERFACEDIR "/bullseye.sti");
 	guiSAMICON                     = AddVideoObjectFromFile(INTERFACEDIR "/sam.sti");
 	guiCHARBETWEENSECTORICONS      = AddVideoObjectFromFile(INTERFACEDIR "/merc_between_sector_icons.sti");
@@ -3687,6 +3797,8 @@ void LoadMapScreenInterfaceMapGraphics()
 void DeleteMapScreenInterfaceMapGraphics()
 {
 	DeleteVideoSurface(guiBIGMAP);
+	DeleteVideoSurface(guiMapTerrainLayer);
+	gfMapTerrainLayerValid = FALSE;
 	DeleteVideoObject(guiBULLSEYE);
 	DeleteVideoObject(guiSAMICON);
 	DeleteVideoObject(guiCHARBETWEENSECTORICONS);
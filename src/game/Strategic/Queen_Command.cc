@@ -80,11 +80,9 @@ UINT8 NumHostilesInSector( INT16 sSectorX, INT16 sSectorY, INT16 sSectorZ )
 		ubNumHostiles = (UINT8)(pSector->ubNumAdmins + pSector->ubNumTroops + pSector->ubNumElites + pSector->ubNumCreatures);
 
 		//Count mobile enemies
-		CFOR_EACH_ENEMY_GROUP(pGroup)
+		CFOR_EACH_ENEMY_GROUP_IN_SECTOR(pGroup, sSectorX, sSectorY)
 		{
-			if (!pGroup->fVehicle             &&
-					pGroup->ubSectorX == sSectorX &&
-					pGroup->ubSectorY == sSectorY)
+			if (!pGroup->fVehicle)
 			{
 				ubNumHostiles += pGroup->ubGroupSize;
 			}
@@ -120,11 +118,9 @@ UINT8 NumEnemiesInAnySector( INT16 sSectorX, INT16 sSectorY, INT16 sSectorZ )
 		ubNumEnemies = (UINT8)(pSector->ubNumAdmins + pSector->ubNumTroops + pSector->ubNumElites);
 
 		//Count mobile enemies
-		CFOR_EACH_ENEMY_GROUP(pGroup)
+		CFOR_EACH_ENEMY_GROUP_IN_SECTOR(pGroup, sSectorX, sSectorY)
 		{
-			if (!pGroup->fVehicle             &&
-					pGroup->ubSectorX == sSectorX &&
-					pGroup->ubSectorY == sSectorY)
+			if (!pGroup->fVehicle)
 			{
 				ubNumEnemies += pGroup->ubGroupSize;
 			}
@@ -143,11 +139,9 @@ UINT8 NumEnemiesInSector( INT16 sSectorX, INT16 sSectorY )
 	pSector = &SectorInfo[ SECTOR( sSectorX, sSectorY ) ];
 	ubNumTroops = (UINT8)(pSector->ubNumAdmins + pSector->ubNumTroops + pSector->ubNumElites);
 
-	CFOR_EACH_ENEMY_GROUP(pGroup)
+	CFOR_EACH_ENEMY_GROUP_IN_SECTOR(pGroup, sSectorX, sSectorY)
 	{
-		if (!pGroup->fVehicle             &&
-				pGroup->ubSectorX == sSectorX &&
-				pGroup->ubSectorY == sSectorY)
+		if (!pGroup->fVehicle)
 		{
 			ubNumTroops += pGroup->ubGroupSize;
 		}
@@ -185,11 +179,9 @@ UINT8 NumMobileEnemiesInSector( INT16 sSectorX, INT16 sSectorY )
 	Assert( sSectorY >= 1 && sSectorY <= 16 );
 
 	ubNumTroops = 0;
-	CFOR_EACH_ENEMY_GROUP(pGroup)
+	CFOR_EACH_ENEMY_GROUP_IN_SECTOR(pGroup, sSectorX, sSectorY)
 	{
-		if (!pGroup->fVehicle             &&
-				pGroup->ubSectorX == sSectorX &&
-				pGroup->ubSectorY == sSectorY)
+		if (!pGroup->fVehicle)
 		{
 			ubNumTroops += pGroup->ubGroupSize;
 		}
@@ -213,11 +205,9 @@ static void GetNumberOfMobileEnemiesInSector(INT16 sSectorX, INT16 sSectorY, UIN
 
 	//Now count the number of mobile groups in the sector.
 	*pubNumTroops = *pubNumElites = *pubNumAdmins = 0;
-	CFOR_EACH_ENEMY_GROUP(pGroup)
+	CFOR_EACH_ENEMY_GROUP_IN_SECTOR(pGroup, sSectorX, sSectorY)
 	{
-		if (!pGroup->fVehicle             &&
-				pGroup->ubSectorX == sSectorX &&
-				pGroup->ubSectorY == sSectorY)
+		if (!pGroup->fVehicle)
 		{
 			*pubNumTroops += pGroup->pEnemyGroup->ubNumTroops;
 			*pubNumElites += pGroup->pEnemyGroup->ubNumElites;
@@ -306,12 +296,10 @@ void EndTacticalBattleForEnemy()
 	gfProfiledEnemyAdded = FALSE;
 
 	// Clear enemies in battle for all mobile groups in the sector
-	CFOR_EACH_ENEMY_GROUP(i)
+	CFOR_EACH_ENEMY_GROUP_IN_SECTOR(i, x, y)
 	{
 		GROUP const& g = *i;
 		if (g.fVehicle)       continue;
-		if (g.ubSectorX != x) continue;
-		if (g.ubSectorY != y) continue;
 		// XXX test for z missing?
 		ENEMYGROUP& eg = *g.pEnemyGroup;
 		eg.ubTroopsInBattle = 0;
@@ -0,0 +1,61 @@
+#include "StrategicBenchmark.h"
+#include "Game_Clock.h"
+#include "Game_Init.h"
+#include "Init.h"
+#include "Random.h"
+#include "ScreenIDs.h"
+#include "Strategic_Movement.h"
+#include "Timer_Control.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+typedef std::chrono::steady_clock BenchmarkClock;
+
+
+int RunStrategicBenchmark(UINT32 const days, UINT32 const seed)
+{
+	if (days == 0)
+	{
+		fprintf(stderr, "The strategic benchmark needs at least one day\n");
+		return EXIT_FAILURE;
+	}
+
+	ShutdownJA2Clock();
+	InitializeRandom(seed);
+
+	if (InitializeJA2() == ERROR_SCREEN) return EXIT_FAILURE;
+	InitNewGame();
+
+	UINT32 const start_time = GetWorldTotalSeconds();
+	UINT32 const end_time   = start_time + days * NUM_SEC_IN_DAY;
+	BenchmarkClock::time_point const start = BenchmarkClock::now();
+
+	while (GetWorldTotalSeconds() < end_time)
+	{
+		// An event interrupting time compression only cuts the window short
+		UINT32 const window = std::min<UINT32>(NUM_SEC_IN_HOUR, end_time - GetWorldTotalSeconds());
+		WarpGameTime(window, WARPTIME_PROCESS_EVENTS_NORMALLY);
+	}
+
+	typedef std::chrono::duration<double, std::milli> Millis;
+	double const wall = Millis(BenchmarkClock::now() - start).count();
+
+	UINT32 groups  = 0;
+	UINT32 enemies = 0;
+	CFOR_EACH_ENEMY_GROUP(g)
+	{
+		++groups;
+		enemies += g->ubGroupSize;
+	}
+
+	printf("Strategic benchmark: %u days in %.1f ms\n", days, wall);
+	printf("  game hours per second %.1f\n", (end_time - start_time) / 3.6 / wall);
+	printf("  day                   %u\n", GetWorldDay());
+	printf("  enemy groups          %u with %u enemies\n", groups, enemies);
+	printf("  random index          %u\n", guiPreRandomIndex);
+	return EXIT_SUCCESS;
+}
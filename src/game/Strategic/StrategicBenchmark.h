@@ -0,0 +1,13 @@
+#ifndef STRATEGICBENCHMARK_H
+#define STRATEGICBENCHMARK_H
+
+#include "Types.h"
+
+
+/* Headless benchmark of the strategic simulation (see -strategicbenchmark).  A
+ * new campaign is started from a fixed random seed and fast-forwarded by `days`
+ * game days in the windows of the time compression throughput mode, without
+ * rendering.  Returns the exit code for the executable. */
+int RunStrategicBenchmark(UINT32 days, UINT32 seed);
+
+#endif
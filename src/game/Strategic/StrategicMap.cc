@@ -115,9 +115,11 @@
 #include <string_theory/string>
 
 #include <algorithm>
+#include <ctype.h>
 #include <iterator>
 #include <map>
 #include <stdexcept>
+#include <stdlib.h>
 
 //Used by PickGridNoToWalkIn
 #define MAX_ATTEMPTS 200
@@ -1272,6 +1274,21 @@ static void InitializeStrategicMapSectorTownNames(void)
 }
 
 
+bool ParseSectorID(char const* const sector, INT16* const x, INT16* const y)
+{
+	char const row = toupper(sector[0]);
+	if (row < 'A' || 'P' < row) return false;
+
+	char* end;
+	long const col = strtol(sector + 1, &end, 10);
+	if (*end != '\0' || col < 1 || 16 < col) return false;
+
+	*x = col;
+	*y = row - 'A' + 1;
+	return true;
+}
+
+
 ST::string GetSectorIDString(INT16 x, INT16 y, INT8 z, BOOLEAN detailed)
 {
 	if (x <= 0 || y <= 0 || z < 0) /* Empty? */
@@ -2479,6 +2496,9 @@ void UpdateAirspaceControl( void )
 		}
 	}
 
+	// The helicopter plots its paths around enemy controlled airspace
+	InvalidateStrategicPathCache();
+
 
 	// check if currently selected arrival sector still has secure airspace
 
@@ -2571,6 +2591,8 @@ void LoadStrategicInfoFromSavedFile(HWFILE const f)
 
 	// Load fFoundOrta
 	FileRead(f, &fFoundOrta, sizeof(BOOLEAN));
+
+	InvalidateStrategicPathCache();
 }
 
 
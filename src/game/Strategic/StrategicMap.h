@@ -84,6 +84,9 @@ ST::string GetShortSectorString(INT16 sMapX, INT16 sMapY);
 // Return a string like 'A9: Omerta'
 ST::string GetSectorIDString(INT16 x, INT16 y, INT8 z, BOOLEAN detailed);
 
+// Parses a string like 'A9' into the sector coordinates, returns false if it is invalid
+bool ParseSectorID(char const* sector, INT16* x, INT16* y);
+
 void GetMapFileName(INT16 x, INT16 y, INT8 z, char* buf, BOOLEAN add_alternate_map_letter);
 
 // Called from within tactical.....
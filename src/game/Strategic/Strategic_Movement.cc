@@ -103,6 +103,13 @@ static GROUP* gpGroupPrompting = NULL;
 
 static UINT32 uniqueIDMask[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
 
+/* Index of the group list, so looking up a group by its ID or the groups in a
+ * sector doesn't walk the whole list.  The sector buckets are kept in list
+ * order, so they find the groups in the same order as a walk of the list. */
+static GROUP*              g_group_by_id[256];
+static std::vector<GROUP*> g_groups_in_sector[256];
+static UINT32              g_next_list_position;
+
 
 static GROUP* gpInitPrebattleGroup = NULL;
 
@@ -185,6 +192,7 @@ void AddPlayerToGroup(GROUP& g, SOLDIERTYPE& s)
 		g.ubSectorX   = s.sSectorX;
 		g.ubSectorY   = s.sSectorY;
 		g.ubSectorZ   = s.bSectorZ;
+		UpdateGroupSectorIndex(g);
 	}
 	else
 	{
@@ -273,6 +281,7 @@ BOOLEAN GroupReversingDirectionsBetweenSectors( GROUP *pGroup, UINT8 ubSectorX,
 	pGroup->ubNextY = pGroup->ubSectorY;
 	pGroup->ubSectorX = pGroup->ubPrevX;
 	pGroup->ubSectorY = pGroup->ubPrevY;
+	UpdateGroupSectorIndex(*pGroup);
 
 	if( pGroup->fPlayer )
 	{
@@ -524,6 +533,75 @@ GROUP* CreateNewEnemyGroupDepartingFromSector( UINT32 uiSector, UINT8 ubNumAdmin
 
 //INTERNAL LIST MANIPULATION FUNCTIONS
 
+static void IndexGroupInSector(GROUP& g)
+{
+	if (!IS_VALID_SECTOR(g.ubSectorX, g.ubSectorY))
+	{
+		g.sIndexedSector = -1;
+		return;
+	}
+
+	g.sIndexedSector = SECTOR(g.ubSectorX, g.ubSectorY);
+	std::vector<GROUP*>& bucket = g_groups_in_sector[g.sIndexedSector];
+	std::vector<GROUP*>::iterator i = bucket.end();
+	while (i != bucket.begin() && (*(i - 1))->uiListPosition > g.uiListPosition) --i;
+	bucket.insert(i, &g);
+}
+
+
+static void UnindexGroupInSector(GROUP& g)
+{
+	if (g.sIndexedSector == -1) return;
+
+	std::vector<GROUP*>& bucket = g_groups_in_sector[g.sIndexedSector];
+	std::vector<GROUP*>::iterator const i = std::find(bucket.begin(), bucket.end(), &g);
+	Assert(i != bucket.end());
+	bucket.erase(i);
+	g.sIndexedSector = -1;
+}
+
+
+// Has to be called after the group was appended to the group list
+static void IndexGroup(GROUP& g)
+{
+	g.uiListPosition = g_next_list_position++;
+	// If an ID is used twice, the first group in the list wins, like in a walk of the list
+	if (!g_group_by_id[g.ubGroupID]) g_group_by_id[g.ubGroupID] = &g;
+	IndexGroupInSector(g);
+}
+
+
+static void UnindexGroup(GROUP& g)
+{
+	UnindexGroupInSector(g);
+
+	if (g_group_by_id[g.ubGroupID] != &g) return;
+	g_group_by_id[g.ubGroupID] = NULL;
+	FOR_EACH_GROUP(i)
+	{
+		if (i == &g || i->ubGroupID != g.ubGroupID) continue;
+		g_group_by_id[g.ubGroupID] = i;
+		break;
+	}
+}
+
+
+void UpdateGroupSectorIndex(GROUP& g)
+{
+	INT16 const sector = IS_VALID_SECTOR(g.ubSectorX, g.ubSectorY) ? SECTOR(g.ubSectorX, g.ubSectorY) : -1;
+	if (sector == g.sIndexedSector) return;
+	UnindexGroupInSector(g);
+	IndexGroupInSector(g);
+}
+
+
+std::vector<GROUP*> const& GetGroupsInSector(UINT8 const x, UINT8 const y)
+{
+	static std::vector<GROUP*> const none;
+	return IS_VALID_SECTOR(x, y) ? g_groups_in_sector[SECTOR(x, y)] : none;
+}
+
+
 //When adding any new group to the list, this is what must be done:
 //1)  Find the first unused ID (unique)
 //2)  Assign that ID to the new group
@@ -546,6 +624,7 @@ static UINT8 AddGroupToList(GROUP* const g)
 		GROUP** i = &gpGroupList;
 		while (*i != NULL) i = &(*i)->next;
 		*i = g;
+		IndexGroup(*g);
 
 		return id;
 	}
@@ -563,6 +642,7 @@ static void RemoveGroupFromList(GROUP* const g)
 
 		// Found the group, so now remove it.
 		*i = g->next;
+		UnindexGroup(*g);
 
 		// Clear the unique group ID
 		const UINT32 index = g->ubGroupID / 32;
@@ -580,12 +660,7 @@ static void RemoveGroupFromList(GROUP* const g)
 
 GROUP* GetGroup( UINT8 ubGroupID )
 {
-	FOR_EACH_GROUP(curr)
-	{
-		if( curr->ubGroupID == ubGroupID )
-			return curr;
-	}
-	return NULL;
+	return g_group_by_id[ubGroupID];
 }
 
 
@@ -1184,6 +1259,7 @@ void GroupArrivedAtSector(GROUP& g, BOOLEAN const check_for_battle, BOOLEAN cons
 	g.ubSectorY = y;
 	g.ubNextX   = 0;
 	g.ubNextY   = 0;
+	UpdateGroupSectorIndex(g);
 
 	if (g.fPlayer)
 	{
@@ -1566,6 +1642,7 @@ static void PrepareGroupsForSimultaneousArrival()
 	first_group.ubNextY         = first_group.ubSectorY;
 	first_group.ubSectorX       = first_group.ubPrevX;
 	first_group.ubSectorY       = first_group.ubPrevY;
+	UpdateGroupSectorIndex(first_group);
 	SetGroupArrivalTime(first_group, latest_arrival_time);
 	first_group.fBetweenSectors = TRUE;
 
@@ -1948,6 +2025,7 @@ void SetGroupSectorValue(INT16 const x, INT16 const y, INT16 const z, GROUP& g)
 	g.ubNextY         = y;
 	g.ubSectorZ       = z;
 	g.fBetweenSectors = FALSE;
+	UpdateGroupSectorIndex(g);
 
 	// Set next sectors same as current
 	g.ubOriginalSector = SECTOR(x, y);
@@ -1978,6 +2056,7 @@ void SetEnemyGroupSector(GROUP& g, UINT8 const sector_id)
 	g.ubSectorY = g.ubNextY = SECTORY(sector_id);
 	g.ubSectorZ = 0;
 	g.fBetweenSectors = FALSE;
+	UpdateGroupSectorIndex(g);
 }
 
 
@@ -2143,6 +2222,26 @@ INT32 FindTravelTimeBetweenWaypoints(WAYPOINT const* const pSource, WAYPOINT con
 #define AIR_TRAVEL_TIME     10
 
 
+// Returns the highest encumbrance in percent of the members of the group who travel on foot
+INT32 GetGroupFootEncumbrance(GROUP const& g)
+{
+	INT32 highest_encumbrance = 100;
+	CFOR_EACH_PLAYER_IN_GROUP(curr, &g)
+	{
+		SOLDIERTYPE const* const s = curr->pSoldier;
+		if (s->bAssignment == VEHICLE) continue;
+		/* Soldier is on foot and travelling.  Factor encumbrance into movement
+		 * rate. */
+		INT32 const encumbrance = CalculateCarriedWeight(s);
+		if (highest_encumbrance < encumbrance)
+		{
+			highest_encumbrance = encumbrance;
+		}
+	}
+	return highest_encumbrance;
+}
+
+
 // Changes: direction contains the strategic move value, not the delta value.
 INT32 GetSectorMvtTimeForGroup(UINT8 const ubSector, UINT8 const direction, GROUP const* const g)
 {
@@ -2187,20 +2286,7 @@ INT32 GetSectorMvtTimeForGroup(UINT8 const ubSector, UINT8 const direction, GROU
 
 		if (g->fPlayer)
 		{
-			INT32 highest_encumbrance = 100;
-			CFOR_EACH_PLAYER_IN_GROUP(curr, g)
-			{
-				SOLDIERTYPE const* const s = curr->pSoldier;
-				if (s->bAssignment == VEHICLE) continue;
-				/* Soldier is on foot and travelling.  Factor encumbrance into movement
-				 * rate. */
-				INT32 const encumbrance = CalculateCarriedWeight(s);
-				if (highest_encumbrance < encumbrance)
-				{
-					highest_encumbrance = encumbrance;
-				}
-			}
-			best_traverse_time = best_traverse_time * highest_encumbrance / 100;
+			best_traverse_time = best_traverse_time * GetGroupFootEncumbrance(*g) / 100;
 		}
 	}
 
@@ -2268,10 +2354,10 @@ INT32 GetSectorMvtTimeForGroup(UINT8 const ubSector, UINT8 const direction, GROU
 UINT8 PlayerMercsInSector(UINT8 const x, UINT8 const y, UINT8 const z)
 {
 	UINT8 n_mercs = 0;
-	CFOR_EACH_PLAYER_GROUP(g)
+	CFOR_EACH_PLAYER_GROUP_IN_SECTOR(g, x, y)
 	{
 		if (g->fBetweenSectors) continue;
-		if (g->ubSectorX != x || g->ubSectorY != y || g->ubSectorZ != z) continue;
+		if (g->ubSectorZ != z)  continue;
 		/* We have a group, make sure that it isn't a group containing only dead
 		 * members. */
 		CFOR_EACH_PLAYER_IN_GROUP(p, g)
@@ -2290,10 +2376,10 @@ UINT8 PlayerMercsInSector(UINT8 const x, UINT8 const y, UINT8 const z)
 UINT8 PlayerGroupsInSector(UINT8 const x, UINT8 const y, UINT8 const z)
 {
 	UINT8 n_groups = 0;
-	CFOR_EACH_PLAYER_GROUP(g)
+	CFOR_EACH_PLAYER_GROUP_IN_SECTOR(g, x, y)
 	{
 		if (g->fBetweenSectors) continue;
-		if (g->ubSectorX != x || g->ubSectorY != y || g->ubSectorZ != z) continue;
+		if (g->ubSectorZ != z)  continue;
 		/* We have a group, make sure that it isn't a group containing only dead
 		 * members. */
 		CFOR_EACH_PLAYER_IN_GROUP(p, g)
@@ -2456,6 +2542,7 @@ void MoveAllGroupsInCurrentSectorToSector(UINT8 const x, UINT8 const y, UINT8 co
 		g->ubSectorX = x;
 		g->ubSectorY = y;
 		g->ubSectorZ = z;
+		UpdateGroupSectorIndex(*g);
 		CFOR_EACH_PLAYER_IN_GROUP(p, g)
 		{
 			p->pSoldier->sSectorX        = x;
@@ -2600,6 +2687,7 @@ void LoadStrategicMovementGroupsFromSavedGameFile(HWFILE const f)
 		// Add the node to the list
 		*anchor = g;
 		anchor  = &g->next;
+		IndexGroup(*g);
 	}
 
 	//@@@ TEMP!
@@ -2879,14 +2967,9 @@ void RetreatGroupToPreviousSector(GROUP& g)
 
 GROUP* FindEnemyMovementGroupInSector(const UINT8 ubSectorX, const UINT8 ubSectorY)
 {
-	FOR_EACH_ENEMY_GROUP(g)
+	FOR_EACH_ENEMY_GROUP_IN_SECTOR(g, ubSectorX, ubSectorY)
 	{
-		if (g->ubSectorX == ubSectorX &&
-				g->ubSectorY == ubSectorY &&
-				g->ubSectorZ == 0)
-		{
-			return g;
-		}
+		if (g->ubSectorZ == 0) return g;
 	}
 	return NULL;
 }
@@ -2894,14 +2977,12 @@ GROUP* FindEnemyMovementGroupInSector(const UINT8 ubSectorX, const UINT8 ubSecto
 
 GROUP* FindPlayerMovementGroupInSector(const UINT8 x, const UINT8 y)
 {
-	FOR_EACH_PLAYER_GROUP(i)
+	FOR_EACH_PLAYER_GROUP_IN_SECTOR(i, x, y)
 	{
 		GROUP& g = *i;
 		// NOTE: These checks must always match the INVOLVED group checks in PBI!!!
 		if (g.ubGroupSize != 0 &&
 			!g.fBetweenSectors &&
-			g.ubSectorX   == x &&
-			g.ubSectorY   == y &&
 			g.ubSectorZ   == 0 &&
 			!GroupHasInTransitDeadOrPOWMercs(g) &&
 			(!IsGroupTheHelicopterGroup(g) || !fHelicopterIsAirBorne))
@@ -3525,6 +3606,7 @@ static void CancelEmptyPersistentGroupMovement(GROUP& g)
 	g.ubSectorY       = 0;
 	g.ubNextX         = 0;
 	g.ubNextY         = 0;
+	UpdateGroupSectorIndex(g);
 }
 
 
@@ -3709,3 +3791,38 @@ bool GroupHasInTransitDeadOrPOWMercs(GROUP const& g)
 	return false;
 }
 
+
+
+#ifdef WITH_UNITTESTS
+#include "gtest/gtest.h"
+
+TEST(StrategicMovement, groupIndex)
+{
+	GROUP* const a = CreateNewEnemyGroupDepartingFromSector(SECTOR(3, 4), 0, 1, 0);
+	GROUP* const b = CreateNewEnemyGroupDepartingFromSector(SECTOR(5, 6), 0, 2, 0);
+	GROUP* const c = CreateNewEnemyGroupDepartingFromSector(SECTOR(3, 4), 0, 3, 0);
+
+	EXPECT_EQ(GetGroup(a->ubGroupID), a);
+	EXPECT_EQ(GetGroup(b->ubGroupID), b);
+	EXPECT_EQ(GetGroup(c->ubGroupID), c);
+	EXPECT_EQ(GetGroupsInSector(3, 4), std::vector<GROUP*>({ a, c }));
+	EXPECT_EQ(GetGroupsInSector(5, 6), std::vector<GROUP*>({ b }));
+	EXPECT_TRUE(GetGroupsInSector(0, 4).empty());
+
+	// Moving keeps the list order in the new sector
+	SetEnemyGroupSector(*a, SECTOR(5, 6));
+	EXPECT_EQ(GetGroupsInSector(3, 4), std::vector<GROUP*>({ c }));
+	EXPECT_EQ(GetGroupsInSector(5, 6), std::vector<GROUP*>({ a, b }));
+	EXPECT_EQ(FindEnemyMovementGroupInSector(5, 6), a);
+
+	UINT8 const id = b->ubGroupID;
+	RemoveGroup(*b);
+	EXPECT_EQ(GetGroup(id), static_cast<GROUP*>(NULL));
+	EXPECT_EQ(GetGroupsInSector(5, 6), std::vector<GROUP*>({ a }));
+
+	RemoveAllGroups();
+	EXPECT_TRUE(GetGroupsInSector(3, 4).empty());
+	EXPECT_TRUE(GetGroupsInSector(5, 6).empty());
+}
+
+#endif
@@ -3,6 +3,8 @@
 
 #include "JA2Types.h"
 
+#include <vector>
+
 
 enum //enemy intentions,
 {
@@ -110,6 +112,10 @@ struct GROUP
 		ENEMYGROUP *pEnemyGroup;		//a structure containing general enemy info
 	};
 	GROUP* next;						//next group
+
+	// Bookkeeping of GetGroupsInSector(), not saved
+	INT16  sIndexedSector;				//sector whose bucket holds the group, -1 for none
+	UINT32 uiListPosition;				//increases along the group list
 };
 
 
@@ -133,6 +139,26 @@ extern GROUP *gpGroupList;
 #define FOR_EACH_PLAYER_GROUP(iter)  BASE_FOR_EACH_PLAYER_GROUP(      GROUP*, iter)
 #define CFOR_EACH_PLAYER_GROUP(iter) BASE_FOR_EACH_PLAYER_GROUP(const GROUP*, iter)
 
+/* The groups whose ubSectorX/Y is the given sector, in the order of the group
+ * list.  This includes groups which are between sectors or underground.  The
+ * body must neither add, remove nor move groups. */
+#define BASE_FOR_EACH_GROUP_IN_SECTOR(type, iter, x, y) \
+	for (type iter : GetGroupsInSector((x), (y)))
+#define FOR_EACH_GROUP_IN_SECTOR(iter, x, y)  BASE_FOR_EACH_GROUP_IN_SECTOR(      GROUP*, iter, x, y)
+#define CFOR_EACH_GROUP_IN_SECTOR(iter, x, y) BASE_FOR_EACH_GROUP_IN_SECTOR(const GROUP*, iter, x, y)
+
+#define BASE_FOR_EACH_ENEMY_GROUP_IN_SECTOR(type, iter, x, y) \
+	BASE_FOR_EACH_GROUP_IN_SECTOR(type, iter, x, y)              \
+		if (iter->fPlayer) continue; else
+#define FOR_EACH_ENEMY_GROUP_IN_SECTOR(iter, x, y)  BASE_FOR_EACH_ENEMY_GROUP_IN_SECTOR(      GROUP*, iter, x, y)
+#define CFOR_EACH_ENEMY_GROUP_IN_SECTOR(iter, x, y) BASE_FOR_EACH_ENEMY_GROUP_IN_SECTOR(const GROUP*, iter, x, y)
+
+#define BASE_FOR_EACH_PLAYER_GROUP_IN_SECTOR(type, iter, x, y) \
+	BASE_FOR_EACH_GROUP_IN_SECTOR(type, iter, x, y)               \
+		if (!iter->fPlayer) continue; else
+#define FOR_EACH_PLAYER_GROUP_IN_SECTOR(iter, x, y)  BASE_FOR_EACH_PLAYER_GROUP_IN_SECTOR(      GROUP*, iter, x, y)
+#define CFOR_EACH_PLAYER_GROUP_IN_SECTOR(iter, x, y) BASE_FOR_EACH_PLAYER_GROUP_IN_SECTOR(const GROUP*, iter, x, y)
+
 #define FOR_EACH_GROUP_SAFE(iter)                                                    \
 	for (GROUP* iter = gpGroupList, * iter##__next; iter != NULL; iter = iter##__next) \
 		if (iter##__next = iter->next, FALSE) {} else                                    \
@@ -146,6 +172,14 @@ extern GROUP *gpGroupList;
 void RemoveAllGroups(void);
 GROUP* GetGroup( UINT8 ubGroupID );
 
+// See FOR_EACH_GROUP_IN_SECTOR()
+std::vector<GROUP*> const& GetGroupsInSector(UINT8 x, UINT8 y);
+
+/* Has to be called after changing ubSectorX/Y of a group in the group list, so
+ * GetGroupsInSector() stays in sync.  Temporary changes, which are undone
+ * before anyone looks up groups, don't need it. */
+void UpdateGroupSectorIndex(GROUP&);
+
 /* Remove a group from the list. This removes all of the waypoints as well as
  * the members of the group. Calling this function doesn't position them in a
  * sector. It is up to you to do that. The event system will automatically
@@ -206,6 +240,10 @@ static UINT32 const TRAVERSE_TIME_IMPOSSIBLE = 0xFFFFFFFF;
 // Get travel time for this group
 INT32 GetSectorMvtTimeForGroup(UINT8 ubSector, UINT8 ubDirection, GROUP const*);
 
+/* The encumbrance of the most encumbered member of a player group who walks, in
+ * percent.  It scales the time the group needs to move on foot. */
+INT32 GetGroupFootEncumbrance(GROUP const&);
+
 UINT8 PlayerMercsInSector( UINT8 ubSectorX, UINT8 ubSectorY, UINT8 ubSectorZ );
 UINT8 PlayerGroupsInSector( UINT8 ubSectorX, UINT8 ubSectorY, UINT8 ubSectorZ );
 
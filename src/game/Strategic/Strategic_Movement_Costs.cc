@@ -1,6 +1,7 @@
 #include "Campaign_Types.h"
 #include "Strategic_Movement.h"
 #include "Strategic_Movement_Costs.h"
+#include "Strategic_Pathing.h"
 #include "GameInstance.h"
 #include "DefaultContentManager.h"
 #include "MovementCostsModel.h"
@@ -22,6 +23,8 @@ void InitStrategicMovementCosts()
 			s.ubTraversability[THROUGH_STRATEGIC_MOVE] = movementCosts->getTraversibilityThrough(x, y);
 		}
 	}
+
+	InvalidateStrategicPathCache();
 }
 
 
@@ -22,6 +22,8 @@
 
 #include <algorithm>
 #include <iterator>
+#include <map>
+#include <vector>
 
 static UINT16  gusMapPathingData[256];
 static BOOLEAN gfPlotToAvoidPlayerInfuencedSectors = FALSE;
@@ -176,9 +178,47 @@ static INT16 const diStratDelta[]=
 };
 
 
+/* The results of FindStratPath().  Besides the sectors, a path only depends on
+ * the traversability of the sectors, the airspace control and how the group
+ * moves.  The latter is part of the key, the cache is dropped when one of the
+ * former changes (see InvalidateStrategicPathCache()). */
+struct StratPathKey
+{
+	INT16   start;
+	INT16   destination;
+	UINT8   transport_mask;
+	INT32   encumbrance;
+	BOOLEAN helicopter;
+	BOOLEAN tactical_traversal;
+	BOOLEAN direct;
+
+	bool operator <(StratPathKey const& o) const
+	{
+		if (start              != o.start)              return start              < o.start;
+		if (destination        != o.destination)        return destination        < o.destination;
+		if (transport_mask     != o.transport_mask)     return transport_mask     < o.transport_mask;
+		if (encumbrance        != o.encumbrance)        return encumbrance        < o.encumbrance;
+		if (helicopter         != o.helicopter)         return helicopter         < o.helicopter;
+		if (tactical_traversal != o.tactical_traversal) return tactical_traversal < o.tactical_traversal;
+		return direct < o.direct;
+	}
+};
+
+// Plenty for the pairs of sectors groups actually move between
+#define MAX_CACHED_STRAT_PATHS (64 * 1024)
+
+static std::map<StratPathKey, std::vector<UINT16>> g_strat_path_cache;
+
+
+void InvalidateStrategicPathCache()
+{
+	g_strat_path_cache.clear();
+}
+
+
 // this will find if a shortest strategic path
 
-INT32 FindStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g, BOOLEAN const fTacticalTraversal)
+static INT32 SearchStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g, BOOLEAN const fTacticalTraversal, BOOLEAN const fPlotDirectPath, BOOLEAN const fHelicopter)
 {
 	INT32 iCnt,ndx,insertNdx,qNewNdx;
 	INT32 iDestX,iDestY,locX,locY,dx,dy;
@@ -186,30 +226,6 @@ INT32 FindStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g
 	UINT16	newLoc,curLoc;
 	TRAILCELLTYPE curCost,newTotCost,nextCost;
 	INT16 sOrigination;
-	BOOLEAN fPlotDirectPath = FALSE;
-	static BOOLEAN fPreviousPlotDirectPath = FALSE;		// don't save
-
-	// ******** Fudge by Bret (for now), curAPcost is never initialized in this function, but should be!
-	// so this is just to keep things happy!
-
-	// for player groups only!
-	if (g.fPlayer)
-	{
-		// if player is holding down SHIFT key, find the shortest route instead of the quickest route!
-		if ( _KeyDown( SHIFT ) )
-		{
-			fPlotDirectPath = TRUE;
-		}
-
-
-		if ( fPlotDirectPath != fPreviousPlotDirectPath )
-		{
-			// must redraw map to erase the previous path...
-			fMapPanelDirty = TRUE;
-			fPreviousPlotDirectPath = fPlotDirectPath;
-		}
-	}
-
 
 	queRequests = 2;
 
@@ -260,9 +276,6 @@ INT32 FindStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g
 	pathQB[ndx].pathNdx		= trailStratTreedxB;
 	trailStratTreedxB++;
 
-	const GROUP* const heli_group = iHelicopterVehicleId != -1 ?
-		GetGroup(GetHelicopter().ubMovementGroup) : 0;
-
 	do
 	{
 		//remove the first and best path so far from the que
@@ -311,7 +324,7 @@ INT32 FindStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g
 			nextCost = GetSectorMvtTimeForGroup(SECTOR(curLoc % MAP_WORLD_X, curLoc / MAP_WORLD_X), iCnt / 2, &g);
 			if (nextCost == TRAVERSE_TIME_IMPOSSIBLE) continue;
 
-			if (&g == heli_group)
+			if (fHelicopter)
 			{
 				// is a heli, its pathing is determined not by time (it's always the same) but by total cost
 				// Skyrider will avoid uncontrolled airspace as much as possible...
@@ -437,6 +450,66 @@ INT32 FindStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g
 }
 
 
+INT32 FindStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g, BOOLEAN const fTacticalTraversal)
+{
+	BOOLEAN fPlotDirectPath = FALSE;
+	static BOOLEAN fPreviousPlotDirectPath = FALSE;		// don't save
+
+	// for player groups only!
+	if (g.fPlayer)
+	{
+		// if player is holding down SHIFT key, find the shortest route instead of the quickest route!
+		if ( _KeyDown( SHIFT ) )
+		{
+			fPlotDirectPath = TRUE;
+		}
+
+
+		if ( fPlotDirectPath != fPreviousPlotDirectPath )
+		{
+			// must redraw map to erase the previous path...
+			fMapPanelDirty = TRUE;
+			fPreviousPlotDirectPath = fPlotDirectPath;
+		}
+	}
+
+	const GROUP* const heli_group = iHelicopterVehicleId != -1 ?
+		GetGroup(GetHelicopter().ubMovementGroup) : 0;
+	BOOLEAN const fHelicopter = &g == heli_group;
+
+	// Avoiding the player depends on where the player is, so don't cache it
+	if (gfPlotToAvoidPlayerInfuencedSectors)
+	{
+		return SearchStratPath(sStart, sDestination, g, fTacticalTraversal, fPlotDirectPath, fHelicopter);
+	}
+
+	StratPathKey key;
+	key.start              = sStart;
+	key.destination        = sDestination;
+	key.transport_mask     = g.ubTransportationMask;
+	key.encumbrance        = g.fPlayer && g.ubTransportationMask & FOOT ? GetGroupFootEncumbrance(g) : 100;
+	key.helicopter         = fHelicopter;
+	key.tactical_traversal = fTacticalTraversal;
+	// The direct path is only used without tactical traversal
+	key.direct             = fPlotDirectPath && !fTacticalTraversal;
+
+	std::map<StratPathKey, std::vector<UINT16>>::const_iterator const i = g_strat_path_cache.find(key);
+	if (i != g_strat_path_cache.end())
+	{
+		std::vector<UINT16> const& path = i->second;
+		std::fill(std::begin(gusMapPathingData), std::end(gusMapPathingData), (UINT16)sStart);
+		std::copy(path.begin(), path.end(), gusMapPathingData);
+		return (INT32)path.size();
+	}
+
+	INT32 const path_len = SearchStratPath(sStart, sDestination, g, fTacticalTraversal, fPlotDirectPath, fHelicopter);
+
+	if (g_strat_path_cache.size() == MAX_CACHED_STRAT_PATHS) g_strat_path_cache.clear();
+	g_strat_path_cache[key].assign(gusMapPathingData, gusMapPathingData + path_len);
+	return path_len;
+}
+
+
 PathSt* BuildAStrategicPath(INT16 const start_sector, INT16 const end_sector, GROUP const& g, BOOLEAN const fTacticalTraversal)
 {
 	if (end_sector < MAP_WORLD_X - 1) return NULL;
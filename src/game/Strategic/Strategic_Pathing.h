@@ -28,6 +28,10 @@ enum{
 
 INT32 FindStratPath(INT16 sStart, INT16 sDestination, GROUP const&, BOOLEAN fTacticalTraversal);
 
+/* Has to be called when the traversability of the sectors or the airspace
+ * control change, because FindStratPath() caches its results. */
+void InvalidateStrategicPathCache();
+
 // build a stategic path
 PathSt* BuildAStrategicPath(INT16 iStartSectorNum, INT16 iEndSectorNum, GROUP const&, BOOLEAN fTacticalTraversal);
 
@@ -1,4 +1,5 @@
 #include <math.h>
+#include "AIBenchmark.h"
 #include "Font_Control.h"
 #include "Handle_Items.h"
 #include "Structure.h"
@@ -578,6 +579,8 @@ static BOOLEAN ResolveHitOnWall(STRUCTURE* pStructure, INT32 iGridNo, INT8 bLOSI
 // - stops at other obstacles
 static INT32 LineOfSightTest(GridNo start_pos, FLOAT dStartZ, GridNo end_pos, FLOAT dEndZ, UINT8 ubTileSightLimit, UINT8 ubTreeSightReduction, INT8 bAware, INT8 bCamouflage, BOOLEAN fSmell, INT16* psWindowGridNo)
 {
+	AIBenchmarkTimer const benchmark_timer(AIB_LOS);
+
 	// Parameters...
 	// the X,Y,Z triplets should be obvious
 	// TileSightLimit is the max # of tiles of distance visible
@@ -3475,6 +3478,8 @@ INT8 FireBulletGivenTarget(SOLDIERTYPE* const pFirer, const FLOAT dEndX, const F
 
 static INT8 ChanceToGetThrough(SOLDIERTYPE* const pFirer, const GridNo end_pos, const FLOAT dEndZ)
 {
+	AIBenchmarkTimer const benchmark_timer(AIB_LOS);
+
 	UINT16  weapon = pFirer->usAttackingWeapon;
 	BOOLEAN buck_shot;
 	if (GCM->getItem(weapon)->getItemClass() == IC_GUN ||
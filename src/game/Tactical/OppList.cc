@@ -1,5 +1,6 @@
 #include "Font.h"
 #include "AI.h"
+#include "AIBenchmark.h"
 #include "Debug_Pages.h"
 #include "Isometric_Utils.h"
 #include "Overhead.h"
@@ -627,6 +628,8 @@ static void OtherTeamsLookForMan(SOLDIERTYPE* pOpponent);
 
 void HandleSight(SOLDIERTYPE& s, SightFlags const sight_flags)
 {
+	AIBenchmarkTimer const benchmark_timer(AIB_OPPLIST);
+
 	if (!s.bActive)                     return;
 	if (!s.bInSector)                   return;
 	if (s.uiStatusFlags & SOLDIER_DEAD) return;
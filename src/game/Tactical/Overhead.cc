@@ -46,6 +46,7 @@
 #include "Soldier_Macros.h"
 #include "EditorMercs.h"
 #include "Soldier_Tile.h"
+#include "Soldier_Spatial.h"
 #include "Structure_Wrap.h"
 #include "Tile_Animation.h"
 #include "Strategic_Merc_Handler.h"
@@ -267,7 +268,9 @@ static void RecountMercSlots(void)
 void AddMercSlot(SOLDIERTYPE* pSoldier)
 {
 	const INT32 iMercIndex = GetFreeMercSlot();
-	if (iMercIndex != -1) MercSlots[iMercIndex] = pSoldier;
+	if (iMercIndex == -1) return;
+	MercSlots[iMercIndex] = pSoldier;
+	AddSoldierToSpatialIndex(*pSoldier);
 }
 
 
@@ -281,6 +284,7 @@ BOOLEAN RemoveMercSlot(SOLDIERTYPE* pSoldier)
 		{
 			MercSlots[i] = NULL;
 			RecountMercSlots();
+			RemoveSoldierFromSpatialIndex(*pSoldier);
 			return TRUE;
 		}
 	}
@@ -408,6 +412,7 @@ void ShutdownTacticalEngine(void)
 void InitOverhead()
 {
 	std::fill(std::begin(MercSlots), std::end(MercSlots), nullptr);
+	ResetSoldierSpatialIndex();
 	std::fill(std::begin(AwaySlots), std::end(AwaySlots), nullptr);
 	std::fill(std::begin(Menptr), std::end(Menptr), SOLDIERTYPE{});
 
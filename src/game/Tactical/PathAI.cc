@@ -26,6 +26,7 @@
 #include "PathAIDebug.h"
 #include "Points.h"
 #include "AI.h"
+#include "AIBenchmark.h"
 #include "Random.h"
 #include "Message.h"
 #include "Structure_Wrap.h"
@@ -458,6 +459,8 @@ static void RestorePathAIToDefaults(void)
 ////////////////////////////////////////////////////////////////////////
 INT32 FindBestPath(SOLDIERTYPE* s, INT16 sDestination, INT8 ubLevel, INT16 usMovementMode, INT8 bCopy, UINT8 fFlags)
 {
+	AIBenchmarkTimer const benchmark_timer(AIB_PATHING);
+
 	INT32 iDestination = sDestination, iOrigination;
 	UINT8 ubCnt = 0 , ubLoopStart = 0, ubLoopEnd = 0, ubLastDir = 0, ubStructIndex;
 	INT8  bLoopState = LOOPING_CLOCKWISE;
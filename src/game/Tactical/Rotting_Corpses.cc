@@ -1,4 +1,5 @@
 #include "Directories.h"
+#include "HImage.h"
 #include "Font_Control.h"
 #include "Lighting.h"
 #include "Overhead.h"
@@ -504,7 +505,7 @@ try
 	if (c->def.usFlags & ROTTING_CORPSE_VEHICLE)
 	{
 		ani->uiFlags |= ANITILE_FORWARD | ANITILE_LOOPING;
-		ani->uiFlags &= ~ANITILE_PAUSED;
+		UnpauseAniTile(ani);
 	}
 
 	InvalidateWorldRedundency();
@@ -544,7 +545,7 @@ static void FreeCorpsePalettes(ROTTING_CORPSE* pCorpse)
 	{
 		if ( pCorpse->pShades[ cnt ] != NULL )
 		{
-			delete[] pCorpse->pShades[ cnt ];
+			Free16BPPPalette(pCorpse->pShades[ cnt ]);
 			pCorpse->pShades[ cnt ] = NULL;
 		}
 	}
@@ -1012,7 +1013,7 @@ void CorpseHit( INT16 sGridNo, UINT16 usStructureID )
 		pCorpse->pAniTile->uiFlags |= ( ANITILE_BACKWARD | ANITILE_PAUSE_AFTER_LOOP );
 
 		// Turn off pause...
-		pCorpse->pAniTile->uiFlags &= (~ANITILE_PAUSED);
+		UnpauseAniTile(pCorpse->pAniTile);
 	}
 
 	// PLay a sound....
@@ -47,6 +47,7 @@
 #include "Utilities.h"
 #include "Strategic.h"
 #include "Soldier_Tile.h"
+#include "Soldier_Spatial.h"
 #include "Smell.h"
 #include "Keys.h"
 #include "Dialogue_Control.h"
@@ -682,7 +683,7 @@ void DeleteSoldier(SOLDIERTYPE& s)
 	FOR_EACH(UINT16*, i, s.pShades)
 	{
 		if (*i == NULL) continue;
-		delete[] *i;
+		Free16BPPPalette(*i);
 		*i = NULL;
 	}
 
@@ -1825,6 +1826,7 @@ static void InternalRemoveSoldierFromGridNo(SOLDIERTYPE& s, BOOLEAN const force)
 	UnMarkMovementReserved(s);
 	HandleCrowShadowRemoveGridNo(s);
 	s.sGridNo = NOWHERE;
+	UpdateSoldierSpatialIndex(s);
 }
 
 
@@ -1950,6 +1952,7 @@ static void SetSoldierGridNo(SOLDIERTYPE& s, GridNo new_grid_no, BOOLEAN const f
 	}
 
 	s.sGridNo = new_grid_no;
+	UpdateSoldierSpatialIndex(s);
 
 	// Check if our new gridno is valid, if not do not set!
 	if (!GridNoOnVisibleWorldTile(new_grid_no)) return;
@@ -4721,7 +4724,7 @@ void CreateSoldierPalettes(SOLDIERTYPE& s)
 	{
 		if (s.pShades[i])
 		{
-			delete[] s.pShades[i];
+			Free16BPPPalette(s.pShades[i]);
 			s.pShades[i] = 0;
 		}
 	}
@@ -32,6 +32,7 @@
 #include "EditorMercs.h"
 #include "Soldier_Tile.h"
 #include "Soldier_Find.h"
+#include "Soldier_Spatial.h"
 #include "Vehicles.h"
 #include "GameSettings.h"
 #include "UI_Cursors.h"
@@ -141,11 +142,17 @@ SOLDIERTYPE* FindSoldier(GridNo const gridno, UINT32 flags)
 		gSoldierStack.fUseGridNo = FALSE;
 	}
 
+	// Only soldiers standing close to the gridno can be under the cursor
+	SOLDIERTYPE* candidates[TOTAL_SOLDIERS];
+	UINT const   n_candidates = flags & FIND_SOLDIER_GRIDNO ?
+		FindSoldiersWithin(gridno, 0, candidates, lengthof(candidates)) :
+		FindSoldiersNearScreenPoint(gridno, candidates, lengthof(candidates));
+
 	INT16        heighest_merc_screen_y = -32000;
 	SOLDIERTYPE* best_merc              = 0;
-	FOR_EACH_MERC(i)
+	for (UINT i = 0; i != n_candidates; ++i)
 	{
-		SOLDIERTYPE& s = **i;
+		SOLDIERTYPE& s = *candidates[i];
 
 		if (s.uiStatusFlags & SOLDIER_DEAD) continue;
 		if (s.bVisible == -1 && !(gTacticalStatus.uiFlags & SHOW_ALL_MERCS)) continue;
@@ -0,0 +1,245 @@
+#include "Soldier_Spatial.h"
+#include "Isometric_Utils.h"
+#include "Overhead_Types.h"
+#include "Soldier_Control.h"
+#include "WorldDef.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+
+#define GRID_DIM   ((WORLD_COLS + SOLDIER_GRID_CELL_SIZE - 1) / SOLDIER_GRID_CELL_SIZE)
+#define GRID_CELLS (GRID_DIM * GRID_DIM)
+
+
+static std::vector<SOLDIERTYPE*> g_cells[GRID_CELLS];
+
+/* State of every soldier, indexed by ubID:
+ * 0 - not tracked, i.e. not in a merc slot
+ * 1 - tracked, but not standing on any gridno
+ * n - tracked and kept in cell n - 2 */
+#define CELL_UNTRACKED 0
+#define CELL_NOWHERE   1
+static UINT16 g_soldier_cell[TOTAL_SOLDIERS];
+
+
+static inline INT16 CellX(GridNo const gridno) { return gridno % WORLD_COLS / SOLDIER_GRID_CELL_SIZE; }
+static inline INT16 CellY(GridNo const gridno) { return gridno / WORLD_COLS / SOLDIER_GRID_CELL_SIZE; }
+
+
+static void RemoveFromCell(SOLDIERTYPE const& s)
+{
+	UINT16 const cell = g_soldier_cell[s.ubID];
+	if (cell < 2) return;
+
+	std::vector<SOLDIERTYPE*>& v = g_cells[cell - 2];
+	std::vector<SOLDIERTYPE*>::iterator const i = std::find(v.begin(), v.end(), &s);
+	if (i != v.end())
+	{
+		*i = v.back();
+		v.pop_back();
+	}
+	g_soldier_cell[s.ubID] = CELL_NOWHERE;
+}
+
+
+static void PlaceInCell(SOLDIERTYPE& s)
+{
+	if (s.sGridNo < 0 || WORLD_MAX <= s.sGridNo)
+	{
+		RemoveFromCell(s);
+		return;
+	}
+
+	UINT16 const new_cell = CellY(s.sGridNo) * GRID_DIM + CellX(s.sGridNo) + 2;
+	if (g_soldier_cell[s.ubID] == new_cell) return;
+
+	RemoveFromCell(s);
+	g_cells[new_cell - 2].push_back(&s);
+	g_soldier_cell[s.ubID] = new_cell;
+}
+
+
+void AddSoldierToSpatialIndex(SOLDIERTYPE& s)
+{
+	if (g_soldier_cell[s.ubID] == CELL_UNTRACKED) g_soldier_cell[s.ubID] = CELL_NOWHERE;
+	PlaceInCell(s);
+}
+
+
+void UpdateSoldierSpatialIndex(SOLDIERTYPE& s)
+{
+	if (g_soldier_cell[s.ubID] == CELL_UNTRACKED) return;
+	PlaceInCell(s);
+}
+
+
+void RemoveSoldierFromSpatialIndex(SOLDIERTYPE const& s)
+{
+	RemoveFromCell(s);
+	g_soldier_cell[s.ubID] = CELL_UNTRACKED;
+}
+
+
+void ResetSoldierSpatialIndex()
+{
+	for (std::vector<SOLDIERTYPE*>& v : g_cells) v.clear();
+	std::fill(std::begin(g_soldier_cell), std::end(g_soldier_cell), CELL_UNTRACKED);
+}
+
+
+static bool LessID(SOLDIERTYPE const* const a, SOLDIERTYPE const* const b)
+{
+	return a->ubID < b->ubID;
+}
+
+
+UINT FindSoldiersWithin(GridNo const gridno, INT16 const radius, SOLDIERTYPE* out[], UINT const max)
+{
+	if (gridno < 0 || WORLD_MAX <= gridno) return 0;
+
+	INT16 const x  = gridno % WORLD_COLS;
+	INT16 const y  = gridno / WORLD_COLS;
+	INT16 const x0 = std::max(0,            x - radius) / SOLDIER_GRID_CELL_SIZE;
+	INT16 const x1 = std::min(WORLD_COLS - 1, x + radius) / SOLDIER_GRID_CELL_SIZE;
+	INT16 const y0 = std::max(0,            y - radius) / SOLDIER_GRID_CELL_SIZE;
+	INT16 const y1 = std::min(WORLD_ROWS - 1, y + radius) / SOLDIER_GRID_CELL_SIZE;
+
+	UINT n = 0;
+	for (INT16 cy = y0; cy <= y1 && n != max; ++cy)
+	{
+		for (INT16 cx = x0; cx <= x1 && n != max; ++cx)
+		{
+			for (SOLDIERTYPE* const s : g_cells[cy * GRID_DIM + cx])
+			{
+				if (SpacesAway(gridno, s->sGridNo) > radius) continue;
+				out[n++] = s;
+				if (n == max) break;
+			}
+		}
+	}
+	std::sort(out, out + n, LessID);
+	return n;
+}
+
+
+UINT FindNearestSoldiers(GridNo const gridno, UINT const k, SOLDIERTYPE* out[])
+{
+	if (k == 0) return 0;
+
+	INT16 dist[TOTAL_SOLDIERS];
+	UINT  n = 0;
+	SoldierSpatialRings rings(gridno, WORLD_COLS);
+	for (;;)
+	{
+		// Nobody further out can beat the k we have got
+		if (n == k && rings.MinDistance() > dist[n - 1]) break;
+
+		SOLDIERTYPE* const s = rings.Next();
+		if (!s) break;
+
+		INT16 const d = SpacesAway(gridno, s->sGridNo);
+		if (n == k && (d > dist[n - 1] || (d == dist[n - 1] && s->ubID > out[n - 1]->ubID))) continue;
+
+		// Insert sorted by distance, then ID
+		UINT i = (n < k ? n++ : n - 1);
+		for (; i > 0 && (dist[i - 1] > d || (dist[i - 1] == d && out[i - 1]->ubID > s->ubID)); --i)
+		{
+			dist[i] = dist[i - 1];
+			out[i]  = out[i - 1];
+		}
+		dist[i] = d;
+		out[i]  = s;
+	}
+	return n;
+}
+
+
+UINT FindSoldiersNearScreenPoint(GridNo const gridno, SOLDIERTYPE* out[], UINT const max)
+{
+	return FindSoldiersWithin(gridno, SOLDIER_PICK_RADIUS, out, max);
+}
+
+
+SoldierSpatialRings::SoldierSpatialRings(GridNo const centre, INT16 const max_radius) :
+	centre_x_(CellX(centre)),
+	centre_y_(CellY(centre)),
+	max_ring_(std::min((max_radius + SOLDIER_GRID_CELL_SIZE - 1) / SOLDIER_GRID_CELL_SIZE, GRID_DIM)),
+	ring_(0),
+	cell_(0),
+	cur_x_(centre_x_),
+	cur_y_(centre_y_),
+	member_(0)
+{
+	if (centre < 0 || WORLD_MAX <= centre) max_ring_ = -1;
+}
+
+
+bool SoldierSpatialRings::NextCell()
+{
+	for (;;)
+	{
+		INT16 const r = ring_;
+		if (r > max_ring_) return false;
+
+		if (cell_ >= (r == 0 ? 1 : 8 * r))
+		{
+			++ring_;
+			cell_ = 0;
+			continue;
+		}
+
+		// Top and bottom row of the ring, then the left and right column
+		INT16 const i    = cell_++;
+		INT16 const side = 2 * r + 1;
+		INT16 x;
+		INT16 y;
+		if (r == 0)
+		{
+			x = centre_x_;
+			y = centre_y_;
+		}
+		else if (i < 2 * side)
+		{
+			x = centre_x_ - r + i % side;
+			y = centre_y_ + (i < side ? -r : r);
+		}
+		else
+		{
+			INT16 const j = i - 2 * side;
+			x = centre_x_ + (j % 2 == 0 ? -r : r);
+			y = centre_y_ - r + 1 + j / 2;
+		}
+
+		if (x < 0 || GRID_DIM <= x || y < 0 || GRID_DIM <= y) continue;
+		cur_x_  = x;
+		cur_y_  = y;
+		member_ = 0;
+		return true;
+	}
+}
+
+
+SOLDIERTYPE* SoldierSpatialRings::Next()
+{
+	if (max_ring_ < 0) return NULL;
+
+	// The first call has not selected a cell yet
+	if (ring_ == 0 && cell_ == 0 && !NextCell()) return NULL;
+
+	for (;;)
+	{
+		std::vector<SOLDIERTYPE*> const& v = g_cells[cur_y_ * GRID_DIM + cur_x_];
+		if (member_ < v.size()) return v[member_++];
+		if (!NextCell()) return NULL;
+	}
+}
+
+
+INT16 SoldierSpatialRings::MinDistance() const
+{
+	if (ring_ > max_ring_) return 0x7FFF;
+	// The ring being walked may still hold soldiers in its unvisited cells
+	return ring_ == 0 ? 0 : (ring_ - 1) * SOLDIER_GRID_CELL_SIZE + 1;
+}
@@ -0,0 +1,69 @@
+#ifndef SOLDIER_SPATIAL_H
+#define SOLDIER_SPATIAL_H
+
+#include "JA2Types.h"
+
+
+/* Uniform grid of the soldiers in the merc slots.  The world is split into
+ * square cells of SOLDIER_GRID_CELL_SIZE tiles and every soldier is kept in
+ * the cell of the gridno he was last placed on by SetSoldierGridNo().  Queries
+ * only visit the cells which can contain a match, instead of every merc
+ * slot. */
+
+#define SOLDIER_GRID_CELL_SIZE 8
+
+/* Soldier sprites reach well above the tile they stand on (roofs, vehicles),
+ * so a soldier can be under the mouse cursor although he stands this many
+ * tiles away from the gridno under it. */
+#define SOLDIER_PICK_RADIUS    24
+
+
+// Start and stop tracking a soldier, follows the merc slots
+void AddSoldierToSpatialIndex(SOLDIERTYPE&);
+void RemoveSoldierFromSpatialIndex(SOLDIERTYPE const&);
+void ResetSoldierSpatialIndex();
+
+// Moves a tracked soldier to the cell of his current gridno
+void UpdateSoldierSpatialIndex(SOLDIERTYPE&);
+
+/* Collects the soldiers standing at most `radius` tiles (see SpacesAway()) from
+ * `gridno`, sorted by ubID.  Returns their number, at most `max`. */
+UINT FindSoldiersWithin(GridNo, INT16 radius, SOLDIERTYPE* out[], UINT max);
+
+/* Collects the `k` soldiers closest to `gridno` (see SpacesAway()), closest
+ * first, ties broken by ubID.  Returns their number. */
+UINT FindNearestSoldiers(GridNo, UINT k, SOLDIERTYPE* out[]);
+
+/* Collects the soldiers which might cover the screen point above `gridno`, so
+ * the caller can test their screen rects.  Sorted by ubID. */
+UINT FindSoldiersNearScreenPoint(GridNo, SOLDIERTYPE* out[], UINT max);
+
+
+/* Walks the soldiers outwards from a gridno, one ring of cells at a time.
+ * MinDistance() is a lower bound for the distance of every soldier not yet
+ * returned by Next(), so nearest neighbour searches with arbitrary filters can
+ * stop as soon as it exceeds the best distance found so far. */
+class SoldierSpatialRings
+{
+	public:
+		SoldierSpatialRings(GridNo centre, INT16 max_radius);
+
+		// Returns the next soldier or NULL if there are no more
+		SOLDIERTYPE* Next();
+
+		INT16 MinDistance() const;
+
+	private:
+		bool NextCell();
+
+		INT16 centre_x_;
+		INT16 centre_y_;
+		INT16 max_ring_;
+		INT16 ring_;
+		INT16 cell_;  // position along the current ring
+		INT16 cur_x_;
+		INT16 cur_y_;
+		UINT  member_;
+};
+
+#endif
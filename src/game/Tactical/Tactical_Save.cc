@@ -50,23 +50,93 @@
 #include "Map_Screen_Interface_Map_Inventory.h"
 #include "ScreenIDs.h"
 #include "FileMan.h"
+#include "StrUtils.h"
 
 #include "ContentManager.h"
 #include "GameInstance.h"
 #include "Logger.h"
 
+#include <algorithm>
+#include <map>
+#include <stdexcept>
 #include <vector>
 
 static BOOLEAN gfWasInMeanwhile = FALSE;
 
 
+struct SectorTempFileKey
+{
+	UINT32 type;
+	INT16  x;
+	INT16  y;
+	INT8   z;
+
+	bool operator <(SectorTempFileKey const& o) const
+	{
+		if (type != o.type) return type < o.type;
+		if (z    != o.z)    return z    < o.z;
+		if (y    != o.y)    return y    < o.y;
+		return x < o.x;
+	}
+};
+
+// The contents of the sector temp files
+static std::map<SectorTempFileKey, std::vector<UINT8>> g_sector_temp_files;
+
+
+SGPFile* OpenSectorTempFileForWriting(SectorFlags const type, INT16 const x, INT16 const y, INT8 const z)
+{
+	std::vector<UINT8>& data = g_sector_temp_files[SectorTempFileKey{type, x, y, z}];
+	data.clear();
+	return FileMan::openInMemory(data);
+}
+
+
+// Returns the contents of the temp file of the sector, throws if it does not exist
+static std::vector<UINT8>& GetSectorTempFile(SectorFlags const type, INT16 const x, INT16 const y, INT8 const z)
+{
+	std::map<SectorTempFileKey, std::vector<UINT8>>::iterator const i = g_sector_temp_files.find(SectorTempFileKey{type, x, y, z});
+	if (i == g_sector_temp_files.end())
+	{
+		throw std::runtime_error(FormattedString("Sector temp file %u of sector %d,%d,%d does not exist", type, x, y, z).to_std_string());
+	}
+	return i->second;
+}
+
+
+SGPFile* OpenSectorTempFile(SectorFlags const type, INT16 const x, INT16 const y, INT8 const z)
+{
+	return FileMan::openInMemory(GetSectorTempFile(type, x, y, z));
+}
+
+
+SGPFile* OpenSectorTempFileForReading(SectorFlags const type, INT16 const x, INT16 const y, INT8 const z)
+{
+	return FileMan::openInMemory(GetSectorTempFile(type, x, y, z));
+}
+
+
+bool DoesSectorTempFileExist(SectorFlags const type, INT16 const x, INT16 const y, INT8 const z)
+{
+	return g_sector_temp_files.count(SectorTempFileKey{type, x, y, z}) != 0;
+}
+
+
+void DeleteSectorTempFile(SectorFlags const type, INT16 const x, INT16 const y, INT8 const z)
+{
+	g_sector_temp_files.erase(SectorTempFileKey{type, x, y, z});
+}
+
+
 static void AddTempFileToSavedGame(HWFILE const f, UINT32 const flags, SectorFlags const type, INT16 const x, INT16 const y, INT8 const z)
 {
 	if (!(flags & type)) return;
 
-	char map_name[128];
-	GetMapTempFileName(type, map_name, x, y, z);
-	SaveFilesToSavedGame(map_name, f);
+	// Same layout as SaveFilesToSavedGame(): the size followed by the contents
+	std::vector<UINT8> const& data = GetSectorTempFile(type, x, y, z);
+	UINT32 const size = static_cast<UINT32>(data.size());
+	FileWrite(f, &size, sizeof(size));
+	if (size != 0) FileWrite(f, data.data(), size);
 }
 
 
@@ -116,9 +186,11 @@ static void RetrieveTempFileFromSavedGame(HWFILE const f, UINT32 const flags, Se
 {
 	if (!(flags & type)) return;
 
-	char map_name[128];
-	GetMapTempFileName(type, map_name, x, y, z);
-	LoadFilesFromSavedGame(map_name, f);
+	UINT32 size;
+	FileRead(f, &size, sizeof(size));
+	std::vector<UINT8>& data = g_sector_temp_files[SectorTempFileKey{type, x, y, z}];
+	data.resize(size);
+	if (size != 0) FileRead(f, data.data(), size);
 }
 
 
@@ -146,16 +218,13 @@ static void RetrieveTempFilesFromSavedGame(HWFILE const f, UINT32& flags, INT16
 	if (flags & SF_CIV_PRESERVED_TEMP_FILE_EXISTS && savegame_version < 78)
 	{
 		// Delete the file, because it is corrupted
-		char map_name[128];
-		GetMapTempFileName(SF_CIV_PRESERVED_TEMP_FILE_EXISTS, map_name, x, y, z);
-		FileDelete(map_name);
+		DeleteSectorTempFile(SF_CIV_PRESERVED_TEMP_FILE_EXISTS, x, y, z);
 		flags &= ~SF_CIV_PRESERVED_TEMP_FILE_EXISTS;
 	}
 }
 
 
-// Load all the temp files from the saved game file and write them into the temp
-// directory
+// Load all the temp files from the saved game file
 void LoadMapTempFilesFromSavedGameFile(HWFILE const f, UINT32 const savegame_version)
 {
 	// HACK FOR GABBY
@@ -218,9 +287,7 @@ void LoadMapTempFilesFromSavedGameFile(HWFILE const f, UINT32 const savegame_ver
 void SaveWorldItemsToTempItemFile(INT16 const sMapX, INT16 const sMapY, INT8 const bMapZ, const std::vector<WORLDITEM>& items)
 {
 	{
-		char filename[128];
-		GetMapTempFileName(SF_ITEM_TEMP_FILE_EXISTS, filename, sMapX, sMapY, bMapZ);
-		AutoSGPFile f(FileMan::openForWriting(filename));
+		AutoSGPFile f(OpenSectorTempFileForWriting(SF_ITEM_TEMP_FILE_EXISTS, sMapX, sMapY, bMapZ));
 		Assert(items.size() <= UINT32_MAX);
 		UINT32 numItems = static_cast<UINT32>(items.size());
 		FileWriteArray(f, numItems, items.data());
@@ -235,14 +302,11 @@ void SaveWorldItemsToTempItemFile(INT16 const sMapX, INT16 const sMapY, INT8 con
 
 std::vector<WORLDITEM> LoadWorldItemsFromTempItemFile(INT16 const x, INT16 const y, INT8 const z)
 {
-	char filename[128];
-	GetMapTempFileName(SF_ITEM_TEMP_FILE_EXISTS, filename, x, y, z);
-
 	std::vector<WORLDITEM> l_items;
 	// If the file doesn't exists, it's no problem
-	if (GCM->doesGameResExists(filename))
+	if (DoesSectorTempFileExist(SF_ITEM_TEMP_FILE_EXISTS, x, y, z))
 	{
-		AutoSGPFile f(GCM->openGameResForReading(filename));
+		AutoSGPFile f(OpenSectorTempFileForReading(SF_ITEM_TEMP_FILE_EXISTS, x, y, z));
 
 		UINT32 numItems = 0;
 		FileRead(f, &numItems, sizeof(UINT32));
@@ -647,6 +711,8 @@ static void LoadAndAddWorldItemsFromTempFile(INT16 const sMapX, INT16 const sMap
 
 void InitTacticalSave()
 {
+	g_sector_temp_files.clear();
+
 	FileMan::createDir(TEMPDIR);
 	EraseDirectory(TEMPDIR);
 }
@@ -654,9 +720,7 @@ void InitTacticalSave()
 
 static void SaveRottingCorpsesToTempCorpseFile(INT16 const x, INT16 const y, INT8 const z)
 {
-	char map_name[128];
-	GetMapTempFileName(SF_ROTTING_CORPSE_TEMP_FILE_EXISTS, map_name, x, y, z);
-	AutoSGPFile f(FileMan::openForWriting(map_name));
+	AutoSGPFile f(OpenSectorTempFileForWriting(SF_ROTTING_CORPSE_TEMP_FILE_EXISTS, x, y, z));
 
 	// Save the number of the rotting corpses
 	UINT32 n_corpses = 0;
@@ -677,13 +741,10 @@ static void LoadRottingCorpsesFromTempCorpseFile(INT16 const x, INT16 const y, I
 {
 	RemoveCorpses();
 
-	char map_name[128];
-	GetMapTempFileName(SF_ROTTING_CORPSE_TEMP_FILE_EXISTS, map_name, x, y, z);
-
 	// If the file doesn't exist, it's no problem.
-	if (!GCM->doesGameResExists(map_name)) return;
+	if (!DoesSectorTempFileExist(SF_ROTTING_CORPSE_TEMP_FILE_EXISTS, x, y, z)) return;
 
-	AutoSGPFile f(GCM->openGameResForReading(map_name));
+	AutoSGPFile f(OpenSectorTempFileForReading(SF_ROTTING_CORPSE_TEMP_FILE_EXISTS, x, y, z));
 
 	// Load the number of Rotting corpses
 	UINT32 n_corpses;
@@ -803,10 +864,10 @@ void ChangeNpcToDifferentSector(MERCPROFILESTRUCT& p, INT16 sSectorX, INT16 sSec
 
 void AddRottingCorpseToUnloadedSectorsRottingCorpseFile(INT16 const sMapX, INT16 const sMapY, INT8 const bMapZ, ROTTING_CORPSE_DEFINITION const* const corpse_def)
 {
-	char map_name[128];
-	GetMapTempFileName(SF_ROTTING_CORPSE_TEMP_FILE_EXISTS, map_name, sMapX, sMapY, bMapZ);
-
-	AutoSGPFile f(FileMan::openForReadWrite(map_name));
+	SectorFlags const type = SF_ROTTING_CORPSE_TEMP_FILE_EXISTS;
+	AutoSGPFile f(DoesSectorTempFileExist(type, sMapX, sMapY, bMapZ) ?
+		OpenSectorTempFile(type, sMapX, sMapY, bMapZ) :
+		OpenSectorTempFileForWriting(type, sMapX, sMapY, bMapZ));
 
 	UINT32 corpse_count;
 	if (FileGetSize(f) != 0)
@@ -1006,98 +1067,138 @@ void InitExitGameDialogBecauseFileHackDetected()
 static UINT8 const* GetRotationArray();
 
 
-void NewJA2EncryptedFileRead(HWFILE const f, BYTE* const pDest, UINT32 const uiBytesToRead)
+#define ROTATION_ARRAY_SIZE 46
+static const UINT8 ubRotationArray[46] = { 132, 235, 125, 99, 15, 220, 140, 89, 205, 132, 254, 144, 217, 78, 156, 58, 215, 76, 163, 187, 55, 49, 65, 48, 156, 140, 201, 68, 184, 13, 45, 69, 102, 185, 122, 225, 23, 250, 160, 220, 114, 240, 64, 175, 057, 233 };
+
+/* The encryption adds the previous encrypted byte and the next byte of the
+ * rotation array to every byte.  It is done on 8 bytes at once in a 64 bit
+ * word, whose bytes are added without carries between them. */
+
+#define BYTES_PER_WORD 8
+#define HIGH_BITS      UINT64_C(0x8080808080808080)
+#define LOW_BYTES      UINT64_C(0x0101010101010101)
+
+// The rotation array, continued cyclically, so a word can start at any index
+struct EncryptionKey
 {
-	FileRead(f, pDest, uiBytesToRead);
+	UINT8  bytes[NEW_ROTATION_ARRAY_SIZE + BYTES_PER_WORD - 1];
+	size_t size;
+};
 
-	const UINT8* const pubRotationArray = GetRotationArray();
-	UINT8              ubArrayIndex     = 0;
-	UINT8              ubLastByte       = 0;
-	for (UINT32 i = 0; i < uiBytesToRead; ++i)
-	{
-		UINT8 const ubLastByteForNextLoop = pDest[i];
-		pDest[i] -= ubLastByte + pubRotationArray[ubArrayIndex];
-		if (++ubArrayIndex >= NEW_ROTATION_ARRAY_SIZE) ubArrayIndex = 0;
-		ubLastByte = ubLastByteForNextLoop;
-	}
+static_assert(ROTATION_ARRAY_SIZE <= NEW_ROTATION_ARRAY_SIZE, "rotation array too large");
+
+
+static EncryptionKey MakeEncryptionKey(UINT8 const* const rotation, size_t const size)
+{
+	EncryptionKey key;
+	for (size_t i = 0; i != size + BYTES_PER_WORD - 1; ++i) key.bytes[i] = rotation[i % size];
+	key.size = size;
+	return key;
 }
 
 
-void NewJA2EncryptedFileWrite(HWFILE const hFile, BYTE const* const data, UINT32 const uiBytesToWrite)
+static inline uint64_t LoadWord(UINT8 const* const p)
 {
-	SGP::Buffer<UINT8> buf(uiBytesToWrite);
-	const UINT8* const pubRotationArray = GetRotationArray();
-	UINT8              ubArrayIndex     = 0;
-	UINT8              last_byte        = 0;
-	for (UINT32 i = 0; i < uiBytesToWrite; ++i)
-	{
-		buf[i] = data[i] + last_byte + pubRotationArray[ubArrayIndex];
-		last_byte = buf[i];
-		if (++ubArrayIndex >= NEW_ROTATION_ARRAY_SIZE) ubArrayIndex = 0;
-	}
+	uint64_t w = 0;
+	for (size_t i = 0; i != BYTES_PER_WORD; ++i) w |= uint64_t(p[i]) << (8 * i);
+	return w;
+}
 
-	FileWrite(hFile, buf, uiBytesToWrite);
+
+static inline void StoreWord(UINT8* const p, uint64_t const w)
+{
+	for (size_t i = 0; i != BYTES_PER_WORD; ++i) p[i] = UINT8(w >> (8 * i));
 }
 
 
-#define ROTATION_ARRAY_SIZE 46
-static const UINT8 ubRotationArray[46] = { 132, 235, 125, 99, 15, 220, 140, 89, 205, 132, 254, 144, 217, 78, 156, 58, 215, 76, 163, 187, 55, 49, 65, 48, 156, 140, 201, 68, 184, 13, 45, 69, 102, 185, 122, 225, 23, 250, 160, 220, 114, 240, 64, 175, 057, 233 };
+static inline uint64_t AddBytes(uint64_t const a, uint64_t const b)
+{
+	return ((a & ~HIGH_BITS) + (b & ~HIGH_BITS)) ^ ((a ^ b) & HIGH_BITS);
+}
 
-void JA2EncryptedFileRead(HWFILE const f, BYTE* const pDest, UINT32 const uiBytesToRead)
+
+static inline uint64_t SubBytes(uint64_t const a, uint64_t const b)
 {
-	FileRead(f, pDest, uiBytesToRead);
+	return ((a | HIGH_BITS) - (b & ~HIGH_BITS)) ^ ((a ^ ~b) & HIGH_BITS);
+}
 
-	UINT8 ubArrayIndex = 0;
-	UINT8 ubLastByte   = 0;
-	for (UINT32 i = 0; i < uiBytesToRead; ++i)
+
+static void DecryptInPlace(UINT8* const data, size_t const size, EncryptionKey const& key)
+{
+	// Backwards, so the previous encrypted byte is still there
+	size_t end = size;
+	for (; end > BYTES_PER_WORD; end -= BYTES_PER_WORD)
 	{
-		UINT8 const ubLastByteForNextLoop = pDest[i];
-		pDest[i] -= ubLastByte + ubRotationArray[ubArrayIndex];
-		if (++ubArrayIndex >= ROTATION_ARRAY_SIZE) ubArrayIndex = 0;
-		ubLastByte = ubLastByteForNextLoop;
+		size_t   const start = end - BYTES_PER_WORD;
+		uint64_t const c     = LoadWord(data + start);
+		uint64_t const prev  = LoadWord(data + start - 1);
+		uint64_t const k     = LoadWord(key.bytes + start % key.size);
+		StoreWord(data + start, SubBytes(SubBytes(c, prev), k));
+	}
+	while (end != 0)
+	{
+		--end;
+		UINT8 const prev = end != 0 ? data[end - 1] : 0;
+		data[end] -= prev + key.bytes[end % key.size];
 	}
 }
 
 
-void JA2EncryptedFileWrite(HWFILE const hFile, BYTE const* const data, UINT32 const uiBytesToWrite)
+static void WriteEncrypted(HWFILE const f, BYTE const* const data, size_t const size, EncryptionKey const& key)
 {
-	SGP::Buffer<UINT8> buf(uiBytesToWrite);
-	UINT8              ubArrayIndex = 0;
-	UINT8              last_byte    = 0;
-	for (UINT32 i = 0; i < uiBytesToWrite; ++i)
-	{
-		buf[i] += data[i] + last_byte + ubRotationArray[ubArrayIndex];
-		last_byte = buf[i];
-		if (++ubArrayIndex >= ROTATION_ARRAY_SIZE) ubArrayIndex = 0;
+	// Encrypted in pieces, so no buffer for all the data is needed
+	UINT8  buf[1024];
+	UINT8  last = 0;
+	size_t pos  = 0;
+	while (pos != size)
+	{
+		size_t const n = std::min(size - pos, sizeof(buf));
+		size_t       i = 0;
+		for (; i + BYTES_PER_WORD <= n; i += BYTES_PER_WORD)
+		{
+			uint64_t x = AddBytes(LoadWord(data + pos + i), LoadWord(key.bytes + (pos + i) % key.size));
+			// Each byte gets the sum of the bytes before it
+			x = AddBytes(x, x <<  8);
+			x = AddBytes(x, x << 16);
+			x = AddBytes(x, x << 32);
+			x = AddBytes(x, last * LOW_BYTES);
+			StoreWord(buf + i, x);
+			last = UINT8(x >> 56);
+		}
+		for (; i != n; ++i)
+		{
+			last += data[pos + i] + key.bytes[(pos + i) % key.size];
+			buf[i] = last;
+		}
+		FileWrite(f, buf, n);
+		pos += n;
 	}
+}
+
+
+void NewJA2EncryptedFileRead(HWFILE const f, BYTE* const pDest, UINT32 const uiBytesToRead)
+{
+	FileRead(f, pDest, uiBytesToRead);
+	DecryptInPlace(pDest, uiBytesToRead, MakeEncryptionKey(GetRotationArray(), NEW_ROTATION_ARRAY_SIZE));
+}
 
-	FileWrite(hFile, buf, uiBytesToWrite);
+
+void NewJA2EncryptedFileWrite(HWFILE const hFile, BYTE const* const data, UINT32 const uiBytesToWrite)
+{
+	WriteEncrypted(hFile, data, uiBytesToWrite, MakeEncryptionKey(GetRotationArray(), NEW_ROTATION_ARRAY_SIZE));
 }
 
 
-void GetMapTempFileName(SectorFlags const uiType, char* const pMapName, INT16 const sMapX, INT16 const sMapY, INT8 const bMapZ)
+void JA2EncryptedFileRead(HWFILE const f, BYTE* const pDest, UINT32 const uiBytesToRead)
 {
-	// Convert the current sector location into a file name
-	char zTempName[512];
-	GetMapFileName(sMapX, sMapY, bMapZ, zTempName, FALSE);
-
-	const char* prefix;
-	switch (uiType)
-	{
-		case SF_ITEM_TEMP_FILE_EXISTS:              prefix = "i";  break;
-		case SF_ROTTING_CORPSE_TEMP_FILE_EXISTS:    prefix = "r";  break;
-		case SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS: prefix = "m";  break;
-		case SF_DOOR_TABLE_TEMP_FILES_EXISTS:       prefix = "d";  break;
-		case SF_REVEALED_STATUS_TEMP_FILE_EXISTS:   prefix = "v";  break;
-		case SF_DOOR_STATUS_TEMP_FILE_EXISTS:       prefix = "ds"; break;
-		case SF_ENEMY_PRESERVED_TEMP_FILE_EXISTS:   prefix = "e";  break;
-		case SF_SMOKE_EFFECTS_TEMP_FILE_EXISTS:     prefix = "sm"; break;
-		case SF_LIGHTING_EFFECTS_TEMP_FILE_EXISTS:  prefix = "l";  break;
-		case SF_CIV_PRESERVED_TEMP_FILE_EXISTS:     prefix = "c";  break;
-
-		default: SLOGA("GetMapTempFileName: invalid Type"); return;
-	}
-	sprintf(pMapName, TEMPDIR "/%s_%s", prefix, zTempName);
+	FileRead(f, pDest, uiBytesToRead);
+	DecryptInPlace(pDest, uiBytesToRead, MakeEncryptionKey(ubRotationArray, ROTATION_ARRAY_SIZE));
+}
+
+
+void JA2EncryptedFileWrite(HWFILE const hFile, BYTE const* const data, UINT32 const uiBytesToWrite)
+{
+	WriteEncrypted(hFile, data, uiBytesToWrite, MakeEncryptionKey(ubRotationArray, ROTATION_ARRAY_SIZE));
 }
 
 
@@ -3486,9 +3587,111 @@ static UINT8 const* GetRotationArray()
 #ifdef WITH_UNITTESTS
 #include "gtest/gtest.h"
 
+#include "externalized/TestUtils.h"
+
 TEST(TacticalSave, asserts)
 {
 	EXPECT_EQ(lengthof(g_encryption_array), static_cast<size_t>(BASE_NUMBER_OF_ROTATION_ARRAYS * 12));
 }
 
+TEST(TacticalSave, sectorTempFiles)
+{
+	EXPECT_FALSE(DoesSectorTempFileExist(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 0));
+	{
+		AutoSGPFile f(OpenSectorTempFileForWriting(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 0));
+		FileWrite(f, "abc", 3);
+	}
+	{
+		AutoSGPFile f(OpenSectorTempFile(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 0));
+		FileSeek(f, 0, FILE_SEEK_FROM_END);
+		FileWrite(f, "d", 1);
+	}
+	EXPECT_TRUE(DoesSectorTempFileExist(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 0));
+	EXPECT_FALSE(DoesSectorTempFileExist(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 1));
+	EXPECT_FALSE(DoesSectorTempFileExist(SF_ROTTING_CORPSE_TEMP_FILE_EXISTS, 9, 1, 0));
+	{
+		AutoSGPFile f(OpenSectorTempFileForReading(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 0));
+		char buf[4];
+		ASSERT_EQ(FileGetSize(f), 4u);
+		FileRead(f, buf, sizeof(buf));
+		EXPECT_EQ(std::string(buf, sizeof(buf)), "abcd");
+	}
+
+	DeleteSectorTempFile(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 0);
+	EXPECT_FALSE(DoesSectorTempFileExist(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 0));
+	EXPECT_THROW(OpenSectorTempFileForReading(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 0), std::runtime_error);
+	EXPECT_THROW(OpenSectorTempFile(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 0), std::runtime_error);
+	EXPECT_FALSE(DoesSectorTempFileExist(SF_ITEM_TEMP_FILE_EXISTS, 9, 1, 0));
+}
+
+// The encryption one byte at a time, as it used to be done
+static std::vector<UINT8> ReferenceEncrypt(std::vector<UINT8> const& data, UINT8 const* const rotation, size_t const rotation_size)
+{
+	std::vector<UINT8> out(data.size());
+	UINT8 last = 0;
+	for (size_t i = 0; i != data.size(); ++i)
+	{
+		out[i] = last = data[i] + last + rotation[i % rotation_size];
+	}
+	return out;
+}
+
+
+static std::vector<UINT8> ReadTestResource(char const* const path)
+{
+	AutoSGPFile f(OpenTestResourceForReading(path));
+	std::vector<UINT8> data(FileGetSize(f));
+	FileRead(f, data.data(), data.size());
+	return data;
+}
+
+
+// Encrypts the data through the file functions and checks the result and that it decrypts again
+static void CheckEncryption(std::vector<UINT8> const& data, bool const old_rotation)
+{
+	UINT8 const* const rotation      = old_rotation ? ubRotationArray     : GetRotationArray();
+	size_t       const rotation_size = old_rotation ? ROTATION_ARRAY_SIZE : NEW_ROTATION_ARRAY_SIZE;
+
+	AutoSGPFile f(FileMan::openInMemory());
+	(old_rotation ? JA2EncryptedFileWrite : NewJA2EncryptedFileWrite)(f, data.data(), static_cast<UINT32>(data.size()));
+	ASSERT_EQ(FileGetMemoryData(f), ReferenceEncrypt(data, rotation, rotation_size));
+
+	std::vector<UINT8> decrypted(data.size());
+	FileSeek(f, 0, FILE_SEEK_FROM_START);
+	(old_rotation ? JA2EncryptedFileRead : NewJA2EncryptedFileRead)(f, decrypted.data(), static_cast<UINT32>(decrypted.size()));
+	ASSERT_EQ(decrypted, data);
+}
+
+
+TEST(TacticalSave, encryptionOfAllLengths)
+{
+	guiJA2EncryptionSet = 5;
+	std::vector<UINT8> data;
+	for (size_t n = 0; n != 2100; ++n)
+	{
+		CheckEncryption(data, true);
+		CheckEncryption(data, false);
+		data.push_back(static_cast<UINT8>(n * 37 + 11));
+	}
+	guiJA2EncryptionSet = 0;
+}
+
+
+TEST(TacticalSave, encryptionOfSavedGames)
+{
+	char const* const saves[] =
+	{
+		"unittests/saves/strac-linux/SaveGame01.sav",
+		"unittests/saves/strac-macos/SaveGame09.sav",
+		"unittests/saves/strac-win/SaveGame09.sav",
+		"unittests/saves/vanilla-russian/SaveGame06.sav"
+	};
+	for (char const* const save : saves)
+	{
+		std::vector<UINT8> const data = ReadTestResource(save);
+		CheckEncryption(data, true);
+		CheckEncryption(data, false);
+	}
+}
+
 #endif
@@ -35,7 +35,7 @@ void AddItemsToUnLoadedSector(INT16 sMapX, INT16 sMapY, INT8 bMapZ, INT16 sGridN
 
 void AddWorldItemsToUnLoadedSector(INT16 sMapX, INT16 sMapY, INT8 bMapZ, const std::vector<WORLDITEM>& wis);
 
-// Delete all the files in the temp directory.
+// Forget the sector temp files and delete all the files in the temp directory.
 void InitTacticalSave();
 
 
@@ -86,7 +86,21 @@ void InitExitGameDialogBecauseFileHackDetected(void);
 
 void HandleAllReachAbleItemsInTheSector(INT16 x, INT16 y, INT8 z);
 
-void GetMapTempFileName(SectorFlags uiType, char* pMapName, INT16 sMapX, INT16 sMapY, INT8 bMapZ);
+/* The temp files of the sectors only live in memory.  They are kept until the
+ * next InitTacticalSave() and travel with the savegames, so nothing of them is
+ * ever written to the temp directory.  The SectorFlags tell the kind of file. */
+
+// Opens the temp file of the sector for writing, discarding its old contents
+SGPFile* OpenSectorTempFileForWriting(SectorFlags, INT16 x, INT16 y, INT8 z);
+
+// Opens the temp file of the sector for reading and writing, throws if it does not exist
+SGPFile* OpenSectorTempFile(SectorFlags, INT16 x, INT16 y, INT8 z);
+
+// Opens the temp file of the sector for reading, throws if it does not exist
+SGPFile* OpenSectorTempFileForReading(SectorFlags, INT16 x, INT16 y, INT8 z);
+
+bool DoesSectorTempFileExist(SectorFlags, INT16 x, INT16 y, INT8 z);
+void DeleteSectorTempFile(SectorFlags, INT16 x, INT16 y, INT8 z);
 
 
 UINT32	GetNumberOfVisibleWorldItemsFromSectorStructureForSector( INT16 sMapX, INT16 sMapY, INT8 bMapZ );
@@ -143,6 +143,7 @@ INT32 AddVehicleToList(const INT16 sMapX, const INT16 sMapY, const INT16 sGridNo
 	g->ubNextY              = sMapY;
 	g->uiTraverseTime       = 0;
 	g->uiArrivalTime        = 0;
+	UpdateGroupSectorIndex(*g);
 
 	return vid;
 }
@@ -26,7 +26,10 @@
 #include "WeaponModels.h"
 
 #include <algorithm>
+#include <functional>
+#include <queue>
 #include <stdexcept>
+#include <unordered_map>
 #include <vector>
 
 //Global dynamic array of all of the items in a loaded map.
@@ -35,20 +38,66 @@ std::vector<WORLDITEM> gWorldItems;
 std::vector<WORLDBOMB> gWorldBombs;
 
 
-static INT32 GetFreeWorldBombIndex(void)
+/* Unused slots of the tables, lowest first, so slots are handed out in the same
+ * order as by a scan of the tables.  Entries are checked when taken, because a
+ * slot might have been cleared behind our back. */
+typedef std::priority_queue<INT32, std::vector<INT32>, std::greater<INT32> > FreeSlots;
+
+static FreeSlots g_free_world_items;
+static FreeSlots g_free_world_bombs;
+
+// Maps a gridno and level to the world items there, in ascending order
+typedef std::unordered_map<UINT32, std::vector<INT32> > WorldItemIndex;
+
+static WorldItemIndex                   g_world_items_at;
+static WorldItemIndex                   g_world_bombs_at;
+static std::unordered_map<INT32, INT32> g_world_bomb_of_item;
+
+
+static UINT32 WorldItemKey(INT16 const sGridNo, UINT8 const ubLevel)
 {
-	INT32 idx;
+	return ubLevel << 16 | static_cast<UINT16>(sGridNo);
+}
+
+
+static void IndexWorldItem(WorldItemIndex& index, WORLDITEM const& wi, INT32 const iItemIndex)
+{
+	std::vector<INT32>& items = index[WorldItemKey(wi.sGridNo, wi.ubLevel)];
+	items.insert(std::lower_bound(items.begin(), items.end(), iItemIndex), iItemIndex);
+}
+
+
+static void UnindexWorldItem(WorldItemIndex& index, WORLDITEM const& wi, INT32 const iItemIndex)
+{
+	WorldItemIndex::iterator const i = index.find(WorldItemKey(wi.sGridNo, wi.ubLevel));
+	if (i == index.end()) return;
+
+	std::vector<INT32>& items = i->second;
+	items.erase(std::remove(items.begin(), items.end(), iItemIndex), items.end());
+	if (items.empty()) index.erase(i);
+}
+
+
+// Returns the world items at the gridno and level, in ascending order
+static std::vector<INT32> GetWorldItemsAt(INT16 const sGridNo, UINT8 const ubLevel)
+{
+	WorldItemIndex::const_iterator const i = g_world_items_at.find(WorldItemKey(sGridNo, ubLevel));
+	return i != g_world_items_at.end() ? i->second : std::vector<INT32>();
+}
+
 
-	Assert(gWorldBombs.size() <= INT32_MAX);
-	for (idx = 0; idx < static_cast<INT32>(gWorldBombs.size()); idx++)
+static INT32 GetFreeWorldBombIndex(void)
+{
+	while (!g_free_world_bombs.empty())
 	{
+		INT32 const idx = g_free_world_bombs.top();
+		g_free_world_bombs.pop();
 		if (!gWorldBombs[idx].fExists) return idx;
 	}
 
+	Assert(gWorldBombs.size() < INT32_MAX);
 	gWorldBombs.push_back(WORLDBOMB{});
-
-	// Return uiCount.....
-	return( idx );
+	return static_cast<INT32>(gWorldBombs.size() - 1);
 }
 
 
@@ -62,6 +111,9 @@ static INT32 AddBombToWorld(INT32 iItemIndex)
 	gWorldBombs[ iBombIndex ].fExists = TRUE;
 	gWorldBombs[ iBombIndex ].iItemIndex = iItemIndex;
 
+	g_world_bomb_of_item[iItemIndex] = iBombIndex;
+	IndexWorldItem(g_world_bombs_at, GetWorldItem(iItemIndex), iItemIndex);
+
 	return ( iBombIndex );
 }
 
@@ -70,24 +122,34 @@ static void RemoveBombFromWorldByItemIndex(INT32 iItemIndex)
 {
 	// Find the world bomb which corresponds with a particular world item, then
 	// remove the world bomb from the table.
-	FOR_EACH_WORLD_BOMB(wb)
-	{
-		if (wb.iItemIndex != iItemIndex) continue;
+	std::unordered_map<INT32, INT32>::iterator const i = g_world_bomb_of_item.find(iItemIndex);
+	if (i == g_world_bomb_of_item.end()) return;
 
-		wb.fExists = FALSE;
-		return;
-	}
+	INT32 const iBombIndex = i->second;
+	g_world_bomb_of_item.erase(i);
+	UnindexWorldItem(g_world_bombs_at, GetWorldItem(iItemIndex), iItemIndex);
+
+	gWorldBombs[iBombIndex].fExists = FALSE;
+	g_free_world_bombs.push(iBombIndex);
 }
 
 
 INT32 FindWorldItemForBombInGridNo(const INT16 sGridNo, const INT8 bLevel)
 {
-	CFOR_EACH_WORLD_BOMB(wb)
+	WorldItemIndex::const_iterator const i = g_world_bombs_at.find(WorldItemKey(sGridNo, bLevel));
+	if (i != g_world_bombs_at.end())
 	{
-		WORLDITEM const& wi = GetWorldItem(wb.iItemIndex);
-		if (wi.sGridNo != sGridNo || wi.ubLevel != bLevel) continue;
-
-		return wb.iItemIndex;
+		// Of several bombs on a tile take the one first in the bomb table
+		INT32 iFirst     = -1;
+		INT32 iFirstBomb = INT32_MAX;
+		for (INT32 const iItemIndex : i->second)
+		{
+			INT32 const iBombIndex = g_world_bomb_of_item[iItemIndex];
+			if (iBombIndex >= iFirstBomb) continue;
+			iFirst     = iItemIndex;
+			iFirstBomb = iBombIndex;
+		}
+		if (iFirst != -1) return iFirst;
 	}
 	throw std::logic_error("Cannot find bomb item");
 }
@@ -146,16 +208,16 @@ void FindPanicBombsAndTriggers(void)
 
 static INT32 GetFreeWorldItemIndex(void)
 {
-	INT32 iItemIndex;
-
-	Assert(gWorldItems.size() <= INT32_MAX);
-	for (iItemIndex = 0; iItemIndex < static_cast<INT32>(gWorldItems.size()); iItemIndex++)
+	while (!g_free_world_items.empty())
 	{
+		INT32 const iItemIndex = g_free_world_items.top();
+		g_free_world_items.pop();
 		if (!gWorldItems[iItemIndex].fExists) return iItemIndex;
 	}
 
+	Assert(gWorldItems.size() < INT32_MAX);
 	gWorldItems.push_back(WORLDITEM{});
-	return iItemIndex;
+	return static_cast<INT32>(gWorldItems.size() - 1);
 }
 
 
@@ -189,6 +251,8 @@ INT32 AddItemToWorld(INT16 sGridNo, const OBJECTTYPE* const pObject, const UINT8
 	wi.bRenderZHeightAboveLevel = bRenderZHeightAboveLevel;
 	wi.o                        = *pObject;
 
+	IndexWorldItem(g_world_items_at, wi, iItemIndex);
+
 	// Add a bomb reference if needed
 	if (usFlags & WORLD_ITEM_ARMED_BOMB)
 	{
@@ -209,7 +273,9 @@ void RemoveItemFromWorld(const INT32 iItemIndex)
 	{
 		RemoveBombFromWorldByItemIndex(iItemIndex);
 	}
+	UnindexWorldItem(g_world_items_at, wi, iItemIndex);
 	wi.fExists = FALSE;
+	g_free_world_items.push(iItemIndex);
 }
 
 
@@ -221,6 +287,12 @@ void TrashWorldItems()
 	}
 	gWorldItems.clear();
 	gWorldBombs.clear();
+
+	g_free_world_items = FreeSlots();
+	g_free_world_bombs = FreeSlots();
+	g_world_items_at.clear();
+	g_world_bombs_at.clear();
+	g_world_bomb_of_item.clear();
 }
 
 
@@ -391,14 +463,9 @@ static void DeleteWorldItemsBelongingToTerroristsWhoAreNotThere(void)
 			if (p.sSectorX == gWorldSectorX && p.sSectorY == gWorldSectorY) continue;
 
 			// then all items in this location should be deleted
-			const INT16 sGridNo = wi.sGridNo;
-			const UINT8 ubLevel = wi.ubLevel;
-			FOR_EACH_WORLD_ITEM(owned_item)
+			for (INT32 const owned_item : GetWorldItemsAt(wi.sGridNo, wi.ubLevel))
 			{
-				if (owned_item.sGridNo == sGridNo && owned_item.ubLevel == ubLevel)
-				{
-					RemoveItemFromPool(owned_item);
-				}
+				RemoveItemFromPool(GetWorldItem(owned_item));
 			}
 		}
 	}
@@ -424,12 +491,9 @@ static void DeleteWorldItemsBelongingToQueenIfThere(void)
 		if (wi.o.ubOwnerProfile != QUEEN)     continue;
 
 		// Delete all items on this tile
-		const INT16 sGridNo = wi.sGridNo;
-		const UINT8 ubLevel = wi.ubLevel;
-		FOR_EACH_WORLD_ITEM(item)
+		for (INT32 const item_idx : GetWorldItemsAt(wi.sGridNo, wi.ubLevel))
 		{
-			if (item.sGridNo != sGridNo) continue;
-			if (item.ubLevel != ubLevel) continue;
+			WORLDITEM& item = GetWorldItem(item_idx);
 
 			// Upgrade equipment
 			switch (item.o.usItem)
@@ -475,4 +539,26 @@ TEST(WorldItems, asserts)
 	EXPECT_EQ(sizeof(WORLDITEM), 52u);
 }
 
+TEST(WorldItems, freeSlotsAndIndexes)
+{
+	OBJECTTYPE o{};
+	INT32 const a = AddItemToWorld(100, &o, 0, 0, 0, 0);
+	INT32 const b = AddItemToWorld(100, &o, 0, WORLD_ITEM_ARMED_BOMB, 0, 0);
+	INT32 const c = AddItemToWorld(200, &o, 1, WORLD_ITEM_ARMED_BOMB, 0, 0);
+	EXPECT_EQ(FindWorldItemForBombInGridNo(100, 0), b);
+	EXPECT_EQ(FindWorldItemForBombInGridNo(200, 1), c);
+	EXPECT_THROW(FindWorldItemForBombInGridNo(200, 0), std::logic_error);
+
+	// Freed slots are reused lowest first
+	RemoveItemFromWorld(c);
+	RemoveItemFromWorld(a);
+	EXPECT_THROW(FindWorldItemForBombInGridNo(200, 1), std::logic_error);
+	EXPECT_EQ(AddItemToWorld(300, &o, 0, 0, 0, 0), a);
+	EXPECT_EQ(AddItemToWorld(300, &o, 0, WORLD_ITEM_ARMED_BOMB, 0, 0), c);
+	EXPECT_EQ(FindWorldItemForBombInGridNo(300, 0), c);
+
+	for (size_t i = 0; i != gWorldItems.size(); ++i) RemoveItemFromWorld(i);
+	EXPECT_TRUE(gWorldBombs.empty() || !gWorldBombs[0].fExists);
+}
+
 #endif
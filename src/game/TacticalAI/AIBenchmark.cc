@@ -0,0 +1,197 @@
+#include "AIBenchmark.h"
+#include "AI.h"
+#include "Bullets.h"
+#include "Campaign_Types.h"
+#include "Event_Pump.h"
+#include "Game_Init.h"
+#include "Init.h"
+#include "Interface.h"
+#include "Overhead.h"
+#include "Physics.h"
+#include "Random.h"
+#include "ScreenIDs.h"
+#include "StrategicMap.h"
+#include "Timer_Control.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// Militia put into the sector when it has none, so the enemies have someone to fight
+#define BENCHMARK_MILITIA 10
+
+// One hour of game time per enemy turn before the AI is considered stuck
+#define MAX_STEPS_PER_TURN (60 * 60 * 1000 / BASETIMESLICE)
+
+
+typedef std::chrono::steady_clock BenchmarkClock;
+
+BOOLEAN gfAIBenchmark = FALSE;
+
+struct SectionStats
+{
+	BenchmarkClock::time_point start;
+	BenchmarkClock::duration   total;
+	UINT32                     calls;
+	bool                       active;
+};
+
+static SectionStats g_sections[NUM_AIB_SECTIONS];
+
+static char const* const g_section_names[] =
+{
+	"pathing",
+	"LOS",
+	"opplist",
+	"decision"
+};
+
+
+bool StartAIBenchmarkSection(AIBenchmarkSection const section)
+{
+	SectionStats& s = g_sections[section];
+	if (s.active) return false;
+	s.active = true;
+	s.start  = BenchmarkClock::now();
+	return true;
+}
+
+
+void StopAIBenchmarkSection(AIBenchmarkSection const section)
+{
+	SectionStats& s = g_sections[section];
+	s.total  += BenchmarkClock::now() - s.start;
+	s.calls  += 1;
+	s.active  = false;
+}
+
+
+static void HashBytes(UINT32& hash, void const* const data, size_t const size)
+{
+	// FNV-1a
+	UINT8 const* const bytes = static_cast<UINT8 const*>(data);
+	for (size_t i = 0; i != size; ++i)
+	{
+		hash ^= bytes[i];
+		hash *= 16777619U;
+	}
+}
+
+
+/* Hashes the parts of the tactical state the AI decides about, so differing
+ * results between runs with the same seed show up. */
+static UINT32 StateChecksum(void)
+{
+	UINT32 hash = 2166136261U;
+	CFOR_EACH_SOLDIER(i)
+	{
+		SOLDIERTYPE const& s = *i;
+		HashBytes(hash, &s.ubID,          sizeof(s.ubID));
+		HashBytes(hash, &s.sGridNo,       sizeof(s.sGridNo));
+		HashBytes(hash, &s.bLevel,        sizeof(s.bLevel));
+		HashBytes(hash, &s.bDirection,    sizeof(s.bDirection));
+		HashBytes(hash, &s.bLife,         sizeof(s.bLife));
+		HashBytes(hash, &s.bBreath,       sizeof(s.bBreath));
+		HashBytes(hash, &s.bActionPoints, sizeof(s.bActionPoints));
+		HashBytes(hash, &s.bOppCnt,       sizeof(s.bOppCnt));
+		HashBytes(hash, &s.usAnimState,   sizeof(s.usAnimState));
+	}
+	HashBytes(hash, &guiPreRandomIndex, sizeof(guiPreRandomIndex));
+	return hash;
+}
+
+
+// Runs one frame of the tactical screen, without the interface and rendering
+static void StepTactical(void)
+{
+	StepJA2Clock();
+	CheckCustomizableTimer();
+	SimulateWorld();
+	UpdateBullets();
+	ExecuteOverhead();
+	DequeAllGameEvents();
+	HandleTopMessages();
+}
+
+
+static void PrintResults(UINT32 const turns, BenchmarkClock::duration const wall)
+{
+	typedef std::chrono::duration<double, std::milli> Millis;
+
+	printf("AI benchmark: %u enemy turns in %.1f ms\n", turns, Millis(wall).count());
+	for (UINT i = 0; i != NUM_AIB_SECTIONS; ++i)
+	{
+		SectionStats const& s  = g_sections[i];
+		double       const  ms = Millis(s.total).count();
+		printf("  %-10s %10u calls %12.3f ms %10.3f us/call\n",
+			g_section_names[i], s.calls, ms, s.calls != 0 ? 1000 * ms / s.calls : 0.0);
+	}
+
+	printf("  checksum   %08X\n", StateChecksum());
+}
+
+
+int RunAIBenchmark(char const* const sector, UINT32 const turns, UINT32 const seed)
+{
+	INT16 x;
+	INT16 y;
+	if (!ParseSectorID(sector, &x, &y))
+	{
+		fprintf(stderr, "Invalid AI benchmark sector '%s'\n", sector);
+		return EXIT_FAILURE;
+	}
+
+	// The clock is stepped by the benchmark, one time slice per frame
+	ShutdownJA2Clock();
+	InitializeRandom(seed);
+
+	if (InitializeJA2() == ERROR_SCREEN) return EXIT_FAILURE;
+	InitNewGame();
+
+	SECTORINFO& info = SectorInfo[SECTOR(x, y)];
+	if (info.ubNumberOfCivsAtLevel[GREEN_MILITIA] + info.ubNumberOfCivsAtLevel[REGULAR_MILITIA] + info.ubNumberOfCivsAtLevel[ELITE_MILITIA] == 0)
+	{
+		info.ubNumberOfCivsAtLevel[REGULAR_MILITIA] = BENCHMARK_MILITIA;
+	}
+	SetCurrentWorldSector(x, y, 0);
+
+	if (NumCapableEnemyInSector() == 0)
+	{
+		fprintf(stderr, "There are no enemies in sector %s\n", sector);
+		return EXIT_FAILURE;
+	}
+
+	gfAIBenchmark = TRUE;
+	BenchmarkClock::time_point const start = BenchmarkClock::now();
+
+	UINT32 done  = 0;
+	UINT32 steps = 0;
+	bool   enemy_turn = false;
+	while (done != turns)
+	{
+		if (!(gTacticalStatus.uiFlags & INCOMBAT))
+		{
+			if (NumCapableEnemyInSector() == 0) break;
+			EnterCombatMode(ENEMY_TEAM);
+		}
+
+		StepTactical();
+
+		bool const now_enemy_turn = gTacticalStatus.ubCurrentTeam == ENEMY_TEAM;
+		if (enemy_turn && !now_enemy_turn) ++done;
+		if (enemy_turn != now_enemy_turn) steps = 0;
+		enemy_turn = now_enemy_turn;
+
+		if (++steps == MAX_STEPS_PER_TURN)
+		{
+			fprintf(stderr, "The AI got stuck in turn %u\n", done + 1);
+			gfAIBenchmark = FALSE;
+			return EXIT_FAILURE;
+		}
+	}
+
+	gfAIBenchmark = FALSE;
+	PrintResults(done, BenchmarkClock::now() - start);
+	return done == turns ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,51 @@
+#ifndef AIBENCHMARK_H
+#define AIBENCHMARK_H
+
+#include "Types.h"
+
+
+/* Headless benchmark of the enemy AI (see -aibenchmark).  A sector is loaded
+ * from a fixed random seed and the enemy turns are played without rendering,
+ * while the time spent in the sections below is measured. */
+
+enum AIBenchmarkSection
+{
+	AIB_PATHING,
+	AIB_LOS,
+	AIB_OPPLIST,
+	AIB_DECISION,
+	NUM_AIB_SECTIONS
+};
+
+extern BOOLEAN gfAIBenchmark;
+
+bool StartAIBenchmarkSection(AIBenchmarkSection);
+void StopAIBenchmarkSection(AIBenchmarkSection);
+
+/* Times its scope as part of a section.  Costs a single test while no
+ * benchmark runs and only the outermost of nested scopes of the same section
+ * is counted, so recursion is not counted twice. */
+class AIBenchmarkTimer
+{
+	public:
+		AIBenchmarkTimer(AIBenchmarkSection const section) :
+			section_(section),
+			timing_(gfAIBenchmark && StartAIBenchmarkSection(section))
+		{}
+
+		~AIBenchmarkTimer()
+		{
+			if (timing_) StopAIBenchmarkSection(section_);
+		}
+
+	private:
+		AIBenchmarkSection const section_;
+		bool               const timing_;
+};
+
+/* Loads the sector (e.g. "A9"), plays `turns` enemy turns and prints the
+ * section timings and a checksum of the resulting state.  Returns the exit
+ * code for the executable. */
+int RunAIBenchmark(char const* sector, UINT32 turns, UINT32 seed);
+
+#endif
@@ -2,6 +2,7 @@
 #include "Structure.h"
 #include "Timer_Control.h"
 #include "AI.h"
+#include "AIBenchmark.h"
 #include "Isometric_Utils.h"
 #include "Overhead.h"
 #include "Overhead_Types.h"
@@ -1169,6 +1170,7 @@ static void TurnBasedHandleNPCAI(SOLDIERTYPE* pSoldier)
 		{
 			if (!(gTacticalStatus.uiFlags & ENGAGED_IN_CONV))
 			{
+				AIBenchmarkTimer const benchmark_timer(AIB_DECISION);
 				if (CREATURE_OR_BLOODCAT( pSoldier ))
 				{
 					pSoldier->bAction = CreatureDecideAction( pSoldier );
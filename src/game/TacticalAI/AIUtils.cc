@@ -13,6 +13,7 @@
 #include "Soldier_Functions.h"
 #include "Buildings.h"
 #include "Soldier_Macros.h"
+#include "Soldier_Spatial.h"
 #include "Render_Fun.h"
 #include "StrategicMap.h"
 #include "Environment.h"
@@ -561,12 +562,17 @@ INT16 RandomFriendWithin(SOLDIERTYPE* const s)
 
 	// build a list of the guynums of all active, eligible friendly mercs
 
+	/* only friends within range of the origin can be visited, use distance - 1,
+	 * because there must be at least 1 tile 1 space closer */
+	SOLDIERTYPE* nearby[TOTAL_SOLDIERS];
+	const UINT   n_nearby = FindSoldiersWithin(usOrigin, usMaxDist + 1, nearby, lengthof(nearby));
+
 	// go through each soldier, looking for "friends" (soldiers on same side)
 	UINT8 ubFriendCount = 0;
-	const SOLDIERTYPE* friends[MAXMERCS];
-	FOR_EACH_MERC(i)
+	const SOLDIERTYPE* friends[TOTAL_SOLDIERS];
+	for (UINT i = 0; i != n_nearby; ++i)
 	{
-		const SOLDIERTYPE* const candidate = *i;
+		const SOLDIERTYPE* const candidate = nearby[i];
 		if (candidate == s) continue; // skip ourselves
 
 		/* if this man not neutral, but is on my side, OR if he is neutral, but so
@@ -585,47 +591,42 @@ INT16 RandomFriendWithin(SOLDIERTYPE* const s)
 		const UINT               chosen_idx = PreRandom(ubFriendCount);
 		const SOLDIERTYPE* const chosen     = friends[chosen_idx];
 
-		/* if our movement range is NOT restricted, or this friend's within range
-		 * use distance - 1, because there must be at least 1 tile 1 space closer */
-		if (SpacesAway(usOrigin, chosen->sGridNo) - 1 <= usMaxDist)
+		// should be close enough, try to find a legal ->sDestination within 1 tile
+
+		BOOLEAN fDirChecked[8];
+		// clear dirChecked flag for all 8 directions
+		for (UINT16 usDirection = 0; usDirection < 8; ++usDirection)
 		{
-			// should be close enough, try to find a legal ->sDestination within 1 tile
+			fDirChecked[usDirection] = FALSE;
+		}
 
-			BOOLEAN fDirChecked[8];
-			// clear dirChecked flag for all 8 directions
-			for (UINT16 usDirection = 0; usDirection < 8; ++usDirection)
+		// examine all 8 spots around friend
+		// keep looking while directions remain and a satisfactory one not found
+		for (UINT8 ubDirsLeft = 8; ubDirsLeft--;)
+		{
+			// randomly select a direction which hasn't been 'checked' yet
+			UINT16 usDirection;
+			do
 			{
-				fDirChecked[usDirection] = FALSE;
+				usDirection = Random(8);
 			}
+			while (fDirChecked[usDirection]);
 
-			// examine all 8 spots around friend
-			// keep looking while directions remain and a satisfactory one not found
-			for (UINT8 ubDirsLeft = 8; ubDirsLeft--;)
-			{
-				// randomly select a direction which hasn't been 'checked' yet
-				UINT16 usDirection;
-				do
-				{
-					usDirection = Random(8);
-				}
-				while (fDirChecked[usDirection]);
-
-				fDirChecked[usDirection] = TRUE;
+			fDirChecked[usDirection] = TRUE;
 
-				// determine the gridno 1 tile away from current friend in this direction
-				const UINT16 usDest = NewGridNo(chosen->sGridNo, DirectionInc( usDirection + 1 ));
+			// determine the gridno 1 tile away from current friend in this direction
+			const UINT16 usDest = NewGridNo(chosen->sGridNo, DirectionInc( usDirection + 1 ));
 
-				// if that's out of bounds, ignore it & check next direction
-				if (usDest == chosen->sGridNo) continue;
+			// if that's out of bounds, ignore it & check next direction
+			if (usDest == chosen->sGridNo) continue;
 
-				// if our movement range is NOT restricted
-				if (SpacesAway(usOrigin,usDest) <= usMaxDist &&
-						LegalNPCDestination(s, usDest, ENSURE_PATH, NOWATER, 0))
-				{
-					s->usActionData = usDest; // store this ->sDestination
-					s->bPathStored  = TRUE;   // optimization - Ian
-					return TRUE;
-				}
+			// if our movement range is NOT restricted
+			if (SpacesAway(usOrigin,usDest) <= usMaxDist &&
+					LegalNPCDestination(s, usDest, ENSURE_PATH, NOWATER, 0))
+			{
+				s->usActionData = usDest; // store this ->sDestination
+				s->bPathStored  = TRUE;   // optimization - Ian
+				return TRUE;
 			}
 		}
 
@@ -1136,9 +1137,20 @@ INT16 ClosestPC(const SOLDIERTYPE* pSoldier, INT16* psDistance)
 	INT16 sMinDist = (INT16)WORLD_MAX;
 	INT16 sDist;
 	INT16 sGridNo = NOWHERE;
+	UINT8 ubClosestID = NOBODY;
 
-	CFOR_EACH_IN_TEAM(pTargetSoldier, OUR_TEAM)
+	// walk outwards from the soldier until nobody further away can be closer
+	SoldierSpatialRings rings(pSoldier->sGridNo, WORLD_COLS);
+	while (rings.MinDistance() <= sMinDist)
 	{
+		const SOLDIERTYPE* const pTargetSoldier = rings.Next();
+		if (!pTargetSoldier) break;
+
+		if (pTargetSoldier->bTeam != OUR_TEAM)
+		{
+			continue;
+		}
+
 		if (!pTargetSoldier->bInSector)
 		{
 			continue;
@@ -1164,10 +1176,12 @@ INT16 ClosestPC(const SOLDIERTYPE* pSoldier, INT16* psDistance)
 			sDist += 10;
 		}
 
-		if (sDist < sMinDist)
+		// on a tie the lowest ID wins, like when walking the team in order
+		if (sDist < sMinDist || (sDist == sMinDist && pTargetSoldier->ubID < ubClosestID))
 		{
 			sMinDist = sDist;
 			sGridNo = pTargetSoldier->sGridNo;
+			ubClosestID = pTargetSoldier->ubID;
 		}
 	}
 
@@ -1460,24 +1474,12 @@ INT16 DistanceToClosestFriend( SOLDIERTYPE * pSoldier )
 	INT16 sMinDist = 1000;
 	INT16 sDist;
 
-	CFOR_EACH_IN_TEAM(pTargetSoldier, pSoldier->bTeam)
+	if (!pSoldier->bInSector)
 	{
-		if (pTargetSoldier == pSoldier) continue;
-
-		if (pSoldier->bInSector)
-		{
-			if (!pTargetSoldier->bInSector)
-			{
-				continue;
-			}
-			// if not conscious, skip him
-			else if (pTargetSoldier->bLife < OKLIFE)
-			{
-				continue;
-			}
-		}
-		else
+		CFOR_EACH_IN_TEAM(pTargetSoldier, pSoldier->bTeam)
 		{
+			if (pTargetSoldier == pSoldier) continue;
+
 			// compare sector #s
 			if ( (pSoldier->sSectorX != pTargetSoldier->sSectorX) ||
 				(pSoldier->sSectorY != pTargetSoldier->sSectorY) ||
@@ -1495,6 +1497,28 @@ INT16 DistanceToClosestFriend( SOLDIERTYPE * pSoldier )
 				return( 1 );
 			}
 		}
+		return( sMinDist );
+	}
+
+	// walk outwards from the soldier until nobody further away can be closer
+	SoldierSpatialRings rings(pSoldier->sGridNo, WORLD_COLS);
+	while (rings.MinDistance() < sMinDist)
+	{
+		const SOLDIERTYPE* const pTargetSoldier = rings.Next();
+		if (!pTargetSoldier) break;
+
+		if (pTargetSoldier == pSoldier) continue;
+		if (pTargetSoldier->bTeam != pSoldier->bTeam) continue;
+
+		if (!pTargetSoldier->bInSector)
+		{
+			continue;
+		}
+		// if not conscious, skip him
+		else if (pTargetSoldier->bLife < OKLIFE)
+		{
+			continue;
+		}
 
 		sDist = SpacesAway(pSoldier->sGridNo,pTargetSoldier->sGridNo);
 
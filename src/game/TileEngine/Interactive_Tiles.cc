@@ -586,6 +586,15 @@ BOOLEAN CheckVideoObjectScreenCoordinateInData(HVOBJECT hSrcVObject, UINT16 usIn
 	iTestPos	= ( ( usHeight - iTestY ) * usWidth ) + iTestX;
 	iStartPos	= 0;
 
+	UINT8 const* const mask = hSrcVObject->OpacityMask(usIndex);
+	if (mask)
+	{
+		// The test position counts from 1
+		if (iTestPos <= 0 || static_cast<UINT32>(iTestPos) > usWidth * usHeight) return FALSE;
+		UINT32 const pos = iTestPos - 1;
+		return (mask[pos / 8] >> (pos % 8)) & 1;
+	}
+
 	UINT8 const* SrcPtr = hSrcVObject->PixData(pTrav);
 
 	do
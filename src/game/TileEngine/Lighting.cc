@@ -2141,23 +2141,14 @@ static void AddSaturatePalette(SGPPaletteEntry Dst[256], const SGPPaletteEntry S
 }
 
 
-static void CreateShadedPalettes(UINT16* Shades[16], const SGPPaletteEntry ShadePal[256])
-{
-	const UINT16* sl0 = gusShadeLevels[0];
-	Shades[0] = Create16BPPPaletteShaded(ShadePal, sl0[0], sl0[1], sl0[2], TRUE);
-	for (UINT i = 1; i < 16; i++)
-	{
-		const UINT16* sl = gusShadeLevels[i];
-		Shades[i] = Create16BPPPaletteShaded(ShadePal, sl[0], sl[1], sl[2], FALSE);
-	}
-}
-
-
 void CreateBiasedShadedPalettes(UINT16* Shades[16], const SGPPaletteEntry ShadePal[256])
 {
+	/* The sets are shared by the biased palette, so soldiers and corpses with
+	 * the same body and colours use the same tables.  A new light colour gives
+	 * new biased palettes, the old sets go with their last owner. */
 	SGPPaletteEntry LightPal[256];
 	AddSaturatePalette(LightPal, ShadePal, &g_light_color);
-	CreateShadedPalettes(Shades, LightPal);
+	CreateSharedShadedPalettes(Shades, LightPal, gusShadeLevels);
 }
 
 
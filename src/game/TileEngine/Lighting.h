@@ -156,6 +156,8 @@ extern SGPPaletteEntry g_light_color;
 
 const char* LightSpriteGetTypeName(const LIGHT_SPRITE*);
 
+/* Creates the shade tables of the palette under the current light colour.  The
+ * tables are shared, free them with Free16BPPPalette(). */
 void CreateBiasedShadedPalettes(UINT16* Shades[16], const SGPPaletteEntry ShadePal[256]);
 
 void LoadShadeTablesFromTextFile(void);
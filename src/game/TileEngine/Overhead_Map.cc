@@ -44,6 +44,9 @@
 #include "ContentManager.h"
 #include "GameInstance.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "Soldier_Init_List.h"
 extern SOLDIERINITNODE *gpSelected;
 
@@ -375,6 +378,7 @@ BOOLEAN InOverheadMap( )
 
 
 static void ClickOverheadRegionCallback(MOUSE_REGION* reg, INT32 reason);
+static void InvalidateOverheadLayers(void);
 
 
 void GoIntoOverheadMap( )
@@ -398,6 +402,8 @@ void GoIntoOverheadMap( )
 	vo->pShades[1] = Create16BPPPaletteShaded(pal, 310, 310, 310, FALSE);
 	vo->pShades[2] = Create16BPPPaletteShaded(pal,   0,   0,   0, FALSE);
 
+	// Lighting may have changed the shades since the layers were rendered
+	InvalidateOverheadLayers();
 	gfOverheadMapDirty = TRUE;
 
 	if( !gfEditMode )
@@ -458,6 +464,8 @@ void KillOverheadMap()
 	DeleteVideoObject(uiOVERMAP);
 	DeleteVideoObject(uiPERSONS);
 
+	InvalidateOverheadLayers();
+
 	HandleTacticalPanelSwitch( );
 	DisableTacticalTeamPanelButtons( FALSE );
 
@@ -472,239 +480,459 @@ static INT16 GetModifiedOffsetLandHeight(INT32 const gridno)
 }
 
 
-void RenderOverheadMap(INT16 const sStartPointX_M, INT16 const sStartPointY_M, INT16 const sStartPointX_S, INT16 const sStartPointY_S, INT16 const sEndXS, INT16 const sEndYS, BOOLEAN const fFromMapUtility)
+/* Part of the world the static layers of the overhead map show.  The layers
+ * are rendered once into an offscreen surface and afterwards only patched
+ * around changed gridnos. */
+struct OverheadView
 {
-	if (!gfOverheadMapDirty) return;
+	INT16 x_m;
+	INT16 y_m;
+	INT16 x_s;
+	INT16 y_s;
+	INT16 end_x_s;
+	INT16 end_y_s;
+	INT16 render_height;
+};
 
-	// Black out
-	ColorFillVideoSurfaceArea(FRAME_BUFFER, sStartPointX_S, sStartPointY_S, sEndXS,	sEndYS, 0);
 
-	InvalidateScreen();
-	gfOverheadMapDirty = FALSE;
+static bool operator ==(OverheadView const& a, OverheadView const& b)
+{
+	return
+		a.x_m           == b.x_m     &&
+		a.y_m           == b.y_m     &&
+		a.x_s           == b.x_s     &&
+		a.y_s           == b.y_s     &&
+		a.end_x_s       == b.end_x_s &&
+		a.end_y_s       == b.end_y_s &&
+		a.render_height == b.render_height;
+}
+
+
+// Beyond this many changed gridnos the layers are rendered again as a whole
+#define MAX_OVERHEAD_DIRTY_GRIDNOS 64
+
+static SGPVSurface*        g_overhead_layers;
+static bool                g_overhead_layers_valid = false;
+static OverheadView        g_overhead_layers_view;
+static std::vector<GridNo> g_overhead_dirty_gridnos;
+
+
+static void InvalidateOverheadLayers(void)
+{
+	g_overhead_layers_valid = false;
+	g_overhead_dirty_gridnos.clear();
+}
+
+
+void InvalidateOverheadMapGridNo(GridNo const gridno)
+{
+	if (!g_overhead_layers_valid) return;
+
+	if (g_overhead_dirty_gridnos.size() == MAX_OVERHEAD_DIRTY_GRIDNOS)
+	{
+		InvalidateOverheadLayers();
+	}
+	else
+	{
+		g_overhead_dirty_gridnos.push_back(gridno);
+	}
+	gfOverheadMapDirty = TRUE;
+}
+
+
+static void BltOverheadTile(UINT16* const buf, UINT32 const pitch, SMALL_TILE_DB const& t, UINT8 const shade, INT16 const x, INT16 const y, SGPRect const* const clip)
+{
+	if (clip)
+	{
+		ETRLEObject const& e    = t.vo->SubregionProperties(t.usSubIndex);
+		INT32       const  left = x + e.sOffsetX;
+		INT32       const  top  = y + e.sOffsetY;
+		if (left >= clip->iRight  || left + e.usWidth  <= clip->iLeft) return;
+		if (top  >= clip->iBottom || top  + e.usHeight <= clip->iTop)  return;
+
+		t.vo->CurrentShade(shade);
+		Blt8BPPDataTo16BPPBufferTransparentClip(buf, pitch, t.vo, x, y, t.usSubIndex, clip);
+	}
+	else
+	{
+		t.vo->CurrentShade(shade);
+		Blt8BPPDataTo16BPPBufferTransparent(buf, pitch, t.vo, x, y, t.usSubIndex);
+	}
+}
+
+
+static void BltOverheadShadow(UINT16* const buf, UINT32 const pitch, SMALL_TILE_DB const& t, UINT8 const shade, INT16 const x, INT16 const y, SGPRect const* const clip)
+{
+	if (clip)
+	{
+		ETRLEObject const& e    = t.vo->SubregionProperties(t.usSubIndex);
+		INT32       const  left = x + e.sOffsetX;
+		INT32       const  top  = y + e.sOffsetY;
+		if (left >= clip->iRight  || left + e.usWidth  <= clip->iLeft) return;
+		if (top  >= clip->iBottom || top  + e.usHeight <= clip->iTop)  return;
+
+		SGPRect clip_rect = *clip;
+		t.vo->CurrentShade(shade);
+		Blt8BPPDataTo16BPPBufferShadowClip(buf, pitch, t.vo, x, y, t.usSubIndex, &clip_rect);
+	}
+	else
+	{
+		t.vo->CurrentShade(shade);
+		Blt8BPPDataTo16BPPBufferShadow(buf, pitch, t.vo, x, y, t.usSubIndex);
+	}
+}
+
+
+/* The tiles of a gridno are drawn within this distance of its position in the
+ * view.  A tile is drawn up to OVERHEAD_MAX_RAISE above the row of its gridno:
+ * by the highest land plus the height of a wall for roofs. */
+#define OVERHEAD_REACH_LEFT  40
+#define OVERHEAD_REACH_RIGHT 48
+#define OVERHEAD_REACH_UP    64
+#define OVERHEAD_REACH_DOWN  32
+#define OVERHEAD_MAX_RAISE   (UINT8_MAX / 5 + WALL_HEIGHT / 5)
+
+
+// Returns the screen row below which no tile can draw into the clip rectangle
+static INT16 GetOverheadEndY(OverheadView const& v, SGPRect const* const clip)
+{
+	if (!clip) return v.end_y_s;
+	return std::min<INT32>(v.end_y_s, clip->iBottom + OVERHEAD_REACH_UP + OVERHEAD_MAX_RAISE - v.render_height / 5);
+}
+
+
+/* Narrows the screen row starting at x_s to the tiles which can draw into the
+ * clip rectangle, and leaves it empty if the row cannot. */
+static void ClipOverheadRow(OverheadView const& v, SGPRect const* const clip, INT16 const y_s, INT16& x_s, INT16& x_m, INT16& y_m, INT16& end_x_s)
+{
+	end_x_s = v.end_x_s;
+	if (!clip) return;
+
+	INT32 const y = y_s + v.render_height / 5;
+	if (y - OVERHEAD_MAX_RAISE - OVERHEAD_REACH_UP >= clip->iBottom || y + OVERHEAD_REACH_DOWN <= clip->iTop)
+	{
+		end_x_s = x_s;
+		return;
+	}
+
+	INT32 const first_x = clip->iLeft - OVERHEAD_REACH_RIGHT + 1;
+	if (x_s < first_x)
+	{
+		INT16 const n_skip = (first_x - x_s + 7) / 8;
+		x_s += 8 * n_skip;
+		x_m += n_skip;
+		y_m -= n_skip;
+	}
+	end_x_s = std::min<INT32>(end_x_s, clip->iRight + OVERHEAD_REACH_LEFT);
+}
 
-	{ SGPVSurface::Lock l(FRAME_BUFFER);
-		UINT16* const pDestBuf         = l.Buffer<UINT16>();
-		UINT32  const uiDestPitchBYTES = l.Pitch();
-
-		{ // Begin Render Loop
-			INT16 sAnchorPosX_M = sStartPointX_M;
-			INT16 sAnchorPosY_M = sStartPointY_M;
-			INT16 sAnchorPosX_S = sStartPointX_S;
-			INT16 sAnchorPosY_S = sStartPointY_S;
-			bool  bXOddFlag     = false;
-			do
+
+/* Renders land, objects, shadows, structures and roofs of the view.  With a
+ * clip rectangle only the tiles overlapping it are visited and drawn. */
+static void RenderOverheadTiles(UINT16* const pDestBuf, UINT32 const uiDestPitchBYTES, OverheadView const& v, SGPRect const* const clip)
+{
+	INT16 const sEndYS = GetOverheadEndY(v, clip);
+
+	{ // Begin Render Loop
+		INT16 sAnchorPosX_M = v.x_m;
+		INT16 sAnchorPosY_M = v.y_m;
+		INT16 sAnchorPosX_S = v.x_s;
+		INT16 sAnchorPosY_S = v.y_s;
+		bool  bXOddFlag     = false;
+		do
+		{
+			INT16 sTempPosX_M = sAnchorPosX_M;
+			INT16 sTempPosY_M = sAnchorPosY_M;
+			INT16 sTempPosX_S = sAnchorPosX_S;
+			INT16 sTempPosY_S = sAnchorPosY_S;
+			if (bXOddFlag) sTempPosX_S += 4;
+			INT16 sEndXS;
+			ClipOverheadRow(v, clip, sTempPosY_S, sTempPosX_S, sTempPosX_M, sTempPosY_M, sEndXS);
+			while (sTempPosX_S < sEndXS)
 			{
-				INT16 sTempPosX_M = sAnchorPosX_M;
-				INT16 sTempPosY_M = sAnchorPosY_M;
-				INT16 sTempPosX_S = sAnchorPosX_S;
-				INT16 sTempPosY_S = sAnchorPosY_S;
-				if (bXOddFlag) sTempPosX_S += 4;
-				do
+				UINT32 const usTileIndex = FASTMAPROWCOLTOPOS(sTempPosY_M, sTempPosX_M);
+				if (usTileIndex < GRIDSIZE)
 				{
-					UINT32 const usTileIndex = FASTMAPROWCOLTOPOS(sTempPosY_M, sTempPosX_M);
-					if (usTileIndex < GRIDSIZE)
+					INT16 const sHeight = GetOffsetLandHeight(usTileIndex) / 5;
+					for (LEVELNODE const* n = gpWorldLevelData[usTileIndex].pLandStart; n; n = n->pPrevNode)
 					{
-						INT16 const sHeight = GetOffsetLandHeight(usTileIndex) / 5;
-						for (LEVELNODE const* n = gpWorldLevelData[usTileIndex].pLandStart; n; n = n->pPrevNode)
-						{
-							SMALL_TILE_DB const& pTile = gSmTileDB[n->usIndex];
-							INT16         const  sX    = sTempPosX_S;
-							INT16         const  sY    = sTempPosY_S - sHeight + gsRenderHeight / 5;
-							pTile.vo->CurrentShade(n->ubShadeLevel);
-							Blt8BPPDataTo16BPPBufferTransparent(pDestBuf, uiDestPitchBYTES, pTile.vo, sX, sY, pTile.usSubIndex);
-						}
+						SMALL_TILE_DB const& pTile = gSmTileDB[n->usIndex];
+						INT16         const  sX    = sTempPosX_S;
+						INT16         const  sY    = sTempPosY_S - sHeight + v.render_height / 5;
+						BltOverheadTile(pDestBuf, uiDestPitchBYTES, pTile, n->ubShadeLevel, sX, sY, clip);
 					}
-
-					sTempPosX_S += 8;
-					++sTempPosX_M;
-					--sTempPosY_M;
 				}
-				while (sTempPosX_S < sEndXS);
 
-				if (bXOddFlag)
-				{
-					++sAnchorPosY_M;
-				}
-				else
-				{
-					++sAnchorPosX_M;
-				}
+				sTempPosX_S += 8;
+				++sTempPosX_M;
+				--sTempPosY_M;
+			}
 
-				bXOddFlag = !bXOddFlag;
-				sAnchorPosY_S += 2;
+			if (bXOddFlag)
+			{
+				++sAnchorPosY_M;
 			}
-			while (sAnchorPosY_S < sEndYS);
+			else
+			{
+				++sAnchorPosX_M;
+			}
+
+			bXOddFlag = !bXOddFlag;
+			sAnchorPosY_S += 2;
 		}
+		while (sAnchorPosY_S < sEndYS);
+	}
 
-		{ // Begin Render Loop
-			INT16 sAnchorPosX_M = sStartPointX_M;
-			INT16 sAnchorPosY_M = sStartPointY_M;
-			INT16 sAnchorPosX_S = sStartPointX_S;
-			INT16 sAnchorPosY_S = sStartPointY_S;
-			bool  bXOddFlag     = false;
-			do
+	{ // Begin Render Loop
+		INT16 sAnchorPosX_M = v.x_m;
+		INT16 sAnchorPosY_M = v.y_m;
+		INT16 sAnchorPosX_S = v.x_s;
+		INT16 sAnchorPosY_S = v.y_s;
+		bool  bXOddFlag     = false;
+		do
+		{
+			INT16 sTempPosX_M = sAnchorPosX_M;
+			INT16 sTempPosY_M = sAnchorPosY_M;
+			INT16 sTempPosX_S = sAnchorPosX_S;
+			INT16 sTempPosY_S = sAnchorPosY_S;
+			if (bXOddFlag) sTempPosX_S += 4;
+			INT16 sEndXS;
+			ClipOverheadRow(v, clip, sTempPosY_S, sTempPosX_S, sTempPosX_M, sTempPosY_M, sEndXS);
+			while (sTempPosX_S < sEndXS)
 			{
-				INT16 sTempPosX_M = sAnchorPosX_M;
-				INT16 sTempPosY_M = sAnchorPosY_M;
-				INT16 sTempPosX_S = sAnchorPosX_S;
-				INT16 sTempPosY_S = sAnchorPosY_S;
-				if (bXOddFlag) sTempPosX_S += 4;
-				do
+				UINT32 const usTileIndex = FASTMAPROWCOLTOPOS(sTempPosY_M, sTempPosX_M);
+				if (usTileIndex < GRIDSIZE)
 				{
-					UINT32 const usTileIndex = FASTMAPROWCOLTOPOS(sTempPosY_M, sTempPosX_M);
-					if (usTileIndex < GRIDSIZE)
+					INT16 const sHeight         = GetOffsetLandHeight(usTileIndex) / 5;
+					INT16 const sModifiedHeight = GetModifiedOffsetLandHeight(usTileIndex) / 5;
+
+					for (LEVELNODE const* n = gpWorldLevelData[usTileIndex].pObjectHead; n; n = n->pNext)
 					{
-						INT16 const sHeight         = GetOffsetLandHeight(usTileIndex) / 5;
-						INT16 const sModifiedHeight = GetModifiedOffsetLandHeight(usTileIndex) / 5;
+						if (n->usIndex >= NUMBEROFTILES) continue;
+						// Don't render itempools!
+						if (n->uiFlags & LEVELNODE_ITEM) continue;
+
+						SMALL_TILE_DB const& pTile = gSmTileDB[n->usIndex];
+						INT16         const  sX    = sTempPosX_S;
+						INT16                sY    = sTempPosY_S;
 
-						for (LEVELNODE const* n = gpWorldLevelData[usTileIndex].pObjectHead; n; n = n->pNext)
+						if (gTileDatabase[n->usIndex].uiFlags & IGNORE_WORLD_HEIGHT)
 						{
-							if (n->usIndex >= NUMBEROFTILES) continue;
-							// Don't render itempools!
-							if (n->uiFlags & LEVELNODE_ITEM) continue;
-
-							SMALL_TILE_DB const& pTile = gSmTileDB[n->usIndex];
-							INT16         const  sX    = sTempPosX_S;
-							INT16                sY    = sTempPosY_S;
-
-							if (gTileDatabase[n->usIndex].uiFlags & IGNORE_WORLD_HEIGHT)
-							{
-								sY -= sModifiedHeight;
-							}
-							else
-							{
-								sY -= sHeight;
-							}
-
-							sY += gsRenderHeight / 5;
-
-							pTile.vo->CurrentShade(n->ubShadeLevel);
-							Blt8BPPDataTo16BPPBufferTransparent(pDestBuf, uiDestPitchBYTES, pTile.vo, sX, sY, pTile.usSubIndex);
+							sY -= sModifiedHeight;
 						}
-
-						for (LEVELNODE const* n = gpWorldLevelData[usTileIndex].pShadowHead; n; n = n->pNext)
+						else
 						{
-							if (n->usIndex >= NUMBEROFTILES) continue;
+							sY -= sHeight;
+						}
 
-							SMALL_TILE_DB const& pTile = gSmTileDB[n->usIndex];
-							INT16         const  sX    = sTempPosX_S;
-							INT16                sY    = sTempPosY_S - sHeight;
+						sY += v.render_height / 5;
 
-							sY += gsRenderHeight / 5;
+						BltOverheadTile(pDestBuf, uiDestPitchBYTES, pTile, n->ubShadeLevel, sX, sY, clip);
+					}
 
-							pTile.vo->CurrentShade(n->ubShadeLevel);
-							Blt8BPPDataTo16BPPBufferShadow(pDestBuf, uiDestPitchBYTES, pTile.vo, sX, sY, pTile.usSubIndex);
-						}
+					for (LEVELNODE const* n = gpWorldLevelData[usTileIndex].pShadowHead; n; n = n->pNext)
+					{
+						if (n->usIndex >= NUMBEROFTILES) continue;
+
+						SMALL_TILE_DB const& pTile = gSmTileDB[n->usIndex];
+						INT16         const  sX    = sTempPosX_S;
+						INT16                sY    = sTempPosY_S - sHeight;
+
+						sY += v.render_height / 5;
+
+						BltOverheadShadow(pDestBuf, uiDestPitchBYTES, pTile, n->ubShadeLevel, sX, sY, clip);
+					}
+
+					for (LEVELNODE const* n = gpWorldLevelData[usTileIndex].pStructHead; n; n = n->pNext)
+					{
+						if (n->usIndex >= NUMBEROFTILES) continue;
+						// Don't render itempools!
+						if (n->uiFlags & LEVELNODE_ITEM) continue;
+
+						SMALL_TILE_DB const& pTile = gSmTileDB[n->usIndex];
+						INT16         const  sX    = sTempPosX_S;
+						INT16                sY    = sTempPosY_S;
 
-						for (LEVELNODE const* n = gpWorldLevelData[usTileIndex].pStructHead; n; n = n->pNext)
+						if (gTileDatabase[n->usIndex].uiFlags & IGNORE_WORLD_HEIGHT)
 						{
-							if (n->usIndex >= NUMBEROFTILES) continue;
-							// Don't render itempools!
-							if (n->uiFlags & LEVELNODE_ITEM) continue;
-
-							SMALL_TILE_DB const& pTile = gSmTileDB[n->usIndex];
-							INT16         const  sX    = sTempPosX_S;
-							INT16                sY    = sTempPosY_S;
-
-							if (gTileDatabase[n->usIndex].uiFlags & IGNORE_WORLD_HEIGHT)
-							{
-								sY -= sModifiedHeight;
-							}
-							else
-							{
-								sY -= sHeight;
-							}
-
-							sY += gsRenderHeight / 5;
-
-							pTile.vo->CurrentShade(n->ubShadeLevel);
-							Blt8BPPDataTo16BPPBufferTransparent(pDestBuf, uiDestPitchBYTES, pTile.vo, sX, sY, pTile.usSubIndex);
+							sY -= sModifiedHeight;
+						}
+						else
+						{
+							sY -= sHeight;
 						}
-					}
 
-					sTempPosX_S += 8;
-					++sTempPosX_M;
-					--sTempPosY_M;
-				}
-				while (sTempPosX_S < sEndXS);
+						sY += v.render_height / 5;
 
-				if (bXOddFlag)
-				{
-					++sAnchorPosY_M;
-				}
-				else
-				{
-					++sAnchorPosX_M;
+						BltOverheadTile(pDestBuf, uiDestPitchBYTES, pTile, n->ubShadeLevel, sX, sY, clip);
+					}
 				}
 
-				bXOddFlag = !bXOddFlag;
-				sAnchorPosY_S += 2;
+				sTempPosX_S += 8;
+				++sTempPosX_M;
+				--sTempPosY_M;
 			}
-			while (sAnchorPosY_S < sEndYS);
+
+			if (bXOddFlag)
+			{
+				++sAnchorPosY_M;
+			}
+			else
+			{
+				++sAnchorPosX_M;
+			}
+
+			bXOddFlag = !bXOddFlag;
+			sAnchorPosY_S += 2;
 		}
+		while (sAnchorPosY_S < sEndYS);
+	}
 
-		{ // ROOF RENDR LOOP
-			// Begin Render Loop
-			INT16 sAnchorPosX_M = sStartPointX_M;
-			INT16 sAnchorPosY_M = sStartPointY_M;
-			INT16 sAnchorPosX_S = sStartPointX_S;
-			INT16 sAnchorPosY_S = sStartPointY_S;
-			bool  bXOddFlag     = false;
-			do
+	{ // ROOF RENDR LOOP
+		// Begin Render Loop
+		INT16 sAnchorPosX_M = v.x_m;
+		INT16 sAnchorPosY_M = v.y_m;
+		INT16 sAnchorPosX_S = v.x_s;
+		INT16 sAnchorPosY_S = v.y_s;
+		bool  bXOddFlag     = false;
+		do
+		{
+			INT16 sTempPosX_M = sAnchorPosX_M;
+			INT16 sTempPosY_M = sAnchorPosY_M;
+			INT16 sTempPosX_S = sAnchorPosX_S;
+			INT16 sTempPosY_S = sAnchorPosY_S;
+			if (bXOddFlag) sTempPosX_S += 4;
+			INT16 sEndXS;
+			ClipOverheadRow(v, clip, sTempPosY_S, sTempPosX_S, sTempPosX_M, sTempPosY_M, sEndXS);
+			while (sTempPosX_S < sEndXS)
 			{
-				INT16 sTempPosX_M = sAnchorPosX_M;
-				INT16 sTempPosY_M = sAnchorPosY_M;
-				INT16 sTempPosX_S = sAnchorPosX_S;
-				INT16 sTempPosY_S = sAnchorPosY_S;
-				if (bXOddFlag) sTempPosX_S += 4;
-				do
+				UINT32 const usTileIndex = FASTMAPROWCOLTOPOS(sTempPosY_M, sTempPosX_M);
+				if (usTileIndex < GRIDSIZE)
 				{
-					UINT32 const usTileIndex = FASTMAPROWCOLTOPOS(sTempPosY_M, sTempPosX_M);
-					if (usTileIndex < GRIDSIZE)
+					INT16 const sHeight = GetOffsetLandHeight(usTileIndex) / 5;
+
+					for (LEVELNODE const* n = gpWorldLevelData[usTileIndex].pRoofHead; n; n = n->pNext)
 					{
-						INT16 const sHeight = GetOffsetLandHeight(usTileIndex) / 5;
+						if (n->usIndex >= NUMBEROFTILES)   continue;
+						if (n->uiFlags & LEVELNODE_HIDDEN) continue;
 
-						for (LEVELNODE const* n = gpWorldLevelData[usTileIndex].pRoofHead; n; n = n->pNext)
-						{
-							if (n->usIndex >= NUMBEROFTILES)   continue;
-							if (n->uiFlags & LEVELNODE_HIDDEN) continue;
+						SMALL_TILE_DB const& pTile = gSmTileDB[n->usIndex];
+						INT16         const  sX    = sTempPosX_S;
+						INT16                sY    = sTempPosY_S - sHeight;
 
-							SMALL_TILE_DB const& pTile = gSmTileDB[n->usIndex];
-							INT16         const  sX    = sTempPosX_S;
-							INT16                sY    = sTempPosY_S - sHeight;
+						sY -= WALL_HEIGHT / 5;
+						sY += v.render_height / 5;
 
-							sY -= WALL_HEIGHT / 5;
-							sY += gsRenderHeight / 5;
+						// RENDER!
+						BltOverheadTile(pDestBuf, uiDestPitchBYTES, pTile, n->ubShadeLevel, sX, sY, clip);
+					}
+				}
 
-							pTile.vo->CurrentShade(n->ubShadeLevel);
+				sTempPosX_S += 8;
+				++sTempPosX_M;
+				--sTempPosY_M;
+			}
 
-							// RENDER!
-							Blt8BPPDataTo16BPPBufferTransparent(pDestBuf, uiDestPitchBYTES, pTile.vo, sX, sY, pTile.usSubIndex);
-						}
-					}
+			if (bXOddFlag)
+			{
+				++sAnchorPosY_M;
+			}
+			else
+			{
+				++sAnchorPosX_M;
+			}
 
-					sTempPosX_S += 8;
-					++sTempPosX_M;
-					--sTempPosY_M;
-				}
-				while (sTempPosX_S < sEndXS);
+			bXOddFlag = !bXOddFlag;
+			sAnchorPosY_S += 2;
+		}
+		while (sAnchorPosY_S < sEndYS);
+	}
+}
 
-				if (bXOddFlag)
-				{
-					++sAnchorPosY_M;
-				}
-				else
-				{
-					++sAnchorPosX_M;
-				}
 
-				bXOddFlag = !bXOddFlag;
-				sAnchorPosY_S += 2;
+/* Gets the part of the view the tiles of a gridno may cover.  The box is
+ * generous, as a small structure tile can reach beyond its own gridno. */
+static bool GetOverheadDirtyRect(OverheadView const& v, GridNo const gridno, SGPRect& r)
+{
+	INT32 const col        = gridno % WORLD_COLS;
+	INT32 const row        = gridno / WORLD_COLS;
+	INT32 const screen_row = col + row - v.x_m - v.y_m;
+	if (screen_row < 0) return false;
+	INT32 const screen_col = col - v.x_m - (screen_row + 1) / 2;
+	if (screen_col < 0) return false;
+
+	INT32 const x = v.x_s + 8 * screen_col + (screen_row & 1 ? 4 : 0);
+	INT32 const y = v.y_s + 2 * screen_row - GetOffsetLandHeight(gridno) / 5 + v.render_height / 5;
+
+	INT32 const left   = std::max<INT32>(x - OVERHEAD_REACH_LEFT,  v.x_s);
+	INT32 const top    = std::max<INT32>(y - OVERHEAD_REACH_UP,    v.y_s);
+	INT32 const right  = std::min<INT32>(x + OVERHEAD_REACH_RIGHT, v.end_x_s);
+	INT32 const bottom = std::min<INT32>(y + OVERHEAD_REACH_DOWN,  v.end_y_s);
+	if (left >= right || top >= bottom) return false;
+
+	r.set(left, top, right, bottom);
+	return true;
+}
+
+
+static void RefreshOverheadLayers(OverheadView const& v)
+{
+	if (!g_overhead_layers)
+	{
+		g_overhead_layers = AddVideoSurface(SCREEN_WIDTH, SCREEN_HEIGHT, PIXEL_DEPTH);
+	}
+
+	if (!g_overhead_layers_valid || !(g_overhead_layers_view == v))
+	{
+		ColorFillVideoSurfaceArea(g_overhead_layers, v.x_s, v.y_s, v.end_x_s, v.end_y_s, 0);
+		SGPVSurface::Lock l(g_overhead_layers);
+		RenderOverheadTiles(l.Buffer<UINT16>(), l.Pitch(), v, NULL);
+	}
+	else if (!g_overhead_dirty_gridnos.empty())
+	{
+		SGPVSurface::Lock l(g_overhead_layers);
+		UINT16* const buf   = l.Buffer<UINT16>();
+		UINT32  const pitch = l.Pitch();
+		for (GridNo const gridno : g_overhead_dirty_gridnos)
+		{
+			SGPRect r;
+			if (!GetOverheadDirtyRect(v, gridno, r)) continue;
+
+			// Each box is cleared and drawn on its own, so shadows are not applied twice where boxes overlap
+			for (UINT16 y = r.iTop; y != r.iBottom; ++y)
+			{
+				UINT16* const line = buf + y * (pitch / 2);
+				std::fill(line + r.iLeft, line + r.iRight, 0);
 			}
-			while (sAnchorPosY_S < sEndYS);
+			RenderOverheadTiles(buf, pitch, v, &r);
 		}
 	}
 
+	g_overhead_layers_valid = true;
+	g_overhead_layers_view  = v;
+	g_overhead_dirty_gridnos.clear();
+}
+
+
+void RenderOverheadMap(INT16 const sStartPointX_M, INT16 const sStartPointY_M, INT16 const sStartPointX_S, INT16 const sStartPointY_S, INT16 const sEndXS, INT16 const sEndYS, BOOLEAN const fFromMapUtility)
+{
+	if (!gfOverheadMapDirty) return;
+
+	InvalidateScreen();
+	gfOverheadMapDirty = FALSE;
+
+	OverheadView const v =
+	{
+		sStartPointX_M, sStartPointY_M,
+		sStartPointX_S, sStartPointY_S,
+		sEndXS,         sEndYS,
+		gsRenderHeight
+	};
+	RefreshOverheadLayers(v);
+
+	SGPBox const area = { (UINT16)sStartPointX_S, (UINT16)sStartPointY_S, (UINT16)(sEndXS - sStartPointX_S), (UINT16)(sEndYS - sStartPointY_S) };
+	BltVideoSurface(FRAME_BUFFER, g_overhead_layers, sStartPointX_S, sStartPointY_S, &area);
+
 	// OK, blacken out edges of smaller maps...
 	if (gMapInformation.ubRestrictedScrollID != 0)
 	{
@@ -959,6 +1187,13 @@ static void CopyOverheadDBShadetablesFromTileset(void)
 
 void TrashOverheadMap(void)
 {
+	InvalidateOverheadLayers();
+	if (g_overhead_layers)
+	{
+		DeleteVideoSurface(g_overhead_layers);
+		g_overhead_layers = 0;
+	}
+
 	if (gubSmTileNum == TILESET_INVALID) return;
 	gubSmTileNum = TILESET_INVALID;
 
@@ -8,6 +8,10 @@
 void InitNewOverheadDB(TileSetID);
 void RenderOverheadMap( INT16 sStartPointX_M, INT16 sStartPointY_M, INT16 sStartPointX_S, INT16 sStartPointY_S, INT16 sEndXS, INT16 sEndYS, BOOLEAN fFromMapUtility );
 
+/* Marks the static tiles of a gridno as changed, so the overhead map redraws
+ * them the next time it is rendered. */
+void InvalidateOverheadMapGridNo(GridNo);
+
 
 void HandleOverheadMap(void);
 BOOLEAN InOverheadMap(void);
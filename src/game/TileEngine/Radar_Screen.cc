@@ -115,10 +115,9 @@ void MoveRadarScreen( )
 	// check if we are allowed to do anything?
 	if (!fRenderRadarScreen) return;
 
-	gRadarRegion.RegionTopLeftX     = RADAR_WINDOW_X;
-	gRadarRegion.RegionTopLeftY     = RADAR_WINDOW_TM_Y;
-	gRadarRegion.RegionBottomRightX = RADAR_WINDOW_X + RADAR_WINDOW_WIDTH;
-	gRadarRegion.RegionBottomRightY = RADAR_WINDOW_TM_Y + RADAR_WINDOW_HEIGHT;
+	MSYS_MoveRegion(&gRadarRegion,
+		RADAR_WINDOW_X, RADAR_WINDOW_TM_Y,
+		RADAR_WINDOW_X + RADAR_WINDOW_WIDTH, RADAR_WINDOW_TM_Y + RADAR_WINDOW_HEIGHT);
 
 }
 
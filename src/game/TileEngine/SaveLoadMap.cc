@@ -39,11 +39,11 @@ UINT8				*gpRevealedMap;
 
 static void SaveModifiedMapStructToMapTempFile(MODIFY_MAP const* const pMap, INT16 const sSectorX, INT16 const sSectorY, INT8 const bSectorZ)
 {
-	CHAR8 zMapName[ 128 ];
-
-	GetMapTempFileName( SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, zMapName, sSectorX, sSectorY, bSectorZ );
-
-	AutoSGPFile hFile(FileMan::openForAppend(zMapName));
+	SectorFlags const type = SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS;
+	AutoSGPFile hFile(DoesSectorTempFileExist(type, sSectorX, sSectorY, bSectorZ) ?
+		OpenSectorTempFile(type, sSectorX, sSectorY, bSectorZ) :
+		OpenSectorTempFileForWriting(type, sSectorX, sSectorY, bSectorZ));
+	FileSeek(hFile, 0, FILE_SEEK_FROM_END);
 	FileWrite(hFile, pMap, sizeof(MODIFY_MAP));
 
 	SetSectorFlag( sSectorX, sSectorY, bSectorZ, SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS );
@@ -60,20 +60,17 @@ static void SetOpenableStructStatusFromMapTempFile(UINT32 uiMapIndex, BOOLEAN fO
 
 void LoadAllMapChangesFromMapTempFileAndApplyThem()
 {
-	CHAR8      zMapName[ 128 ];
 	UINT32     uiNumberOfElementsSavedBackToFile = 0; // added becuase if no files get saved back to disk, the flag needs to be erased
 	UINT32     cnt;
 	MODIFY_MAP *pMap;
 
-	GetMapTempFileName( SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, zMapName, gWorldSectorX, gWorldSectorY, gbWorldSectorZ );
-
 	//If the file doesnt exists, its no problem.
-	if (!GCM->doesGameResExists(zMapName)) return;
+	if (!DoesSectorTempFileExist(SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, gWorldSectorX, gWorldSectorY, gbWorldSectorZ)) return;
 
 	UINT32                  uiNumberOfElements;
 	SGP::Buffer<MODIFY_MAP> pTempArrayOfMaps;
 	{
-		AutoSGPFile hFile(GCM->openGameResForReading(zMapName));
+		AutoSGPFile hFile(OpenSectorTempFileForReading(SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, gWorldSectorX, gWorldSectorY, gbWorldSectorZ));
 
 		//Get the size of the file
 		uiNumberOfElements = FileGetSize(hFile) / sizeof(MODIFY_MAP);
@@ -84,7 +81,7 @@ void LoadAllMapChangesFromMapTempFileAndApplyThem()
 	}
 
 	//Delete the file
-	FileDelete( zMapName );
+	DeleteSectorTempFile(SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, gWorldSectorX, gWorldSectorY, gbWorldSectorZ);
 
 	for( cnt=0; cnt< uiNumberOfElements; cnt++ )
 	{
@@ -384,7 +381,7 @@ void SaveBloodSmellAndRevealedStatesFromMapToTempFile()
 // The BloodInfo is saved in the bottom byte and the smell info in the upper byte
 static void AddBloodOrSmellFromMapTempFileToMap(MODIFY_MAP* pMap)
 {
-	gpWorldLevelData[ pMap->usGridNo ].ubBloodInfo = (UINT8)pMap->usImageType;
+	SetBloodAndSmell(pMap->usGridNo, (UINT8)pMap->usImageType, (UINT8)pMap->usSubImageIndex);
 
 	//if the blood and gore option IS set, add blood
 	if( gGameSettings.fOptions[ TOPTION_BLOOD_N_GORE ] )
@@ -395,20 +392,14 @@ static void AddBloodOrSmellFromMapTempFileToMap(MODIFY_MAP* pMap)
 		gpWorldLevelData[ pMap->usGridNo ].uiFlags |= MAPELEMENT_REEVALUATEBLOOD;
 		UpdateBloodGraphics( pMap->usGridNo, 1 );
 	}
-
-	gpWorldLevelData[ pMap->usGridNo ].ubSmellInfo = (UINT8)pMap->usSubImageIndex;
 }
 
 
 void SaveRevealedStatusArrayToRevealedTempFile(INT16 const sSectorX, INT16 const sSectorY, INT8 const bSectorZ)
 {
-	CHAR8		zMapName[ 128 ];
-
 	Assert( gpRevealedMap != NULL );
 
-	GetMapTempFileName( SF_REVEALED_STATUS_TEMP_FILE_EXISTS, zMapName, sSectorX, sSectorY, bSectorZ );
-
-	AutoSGPFile hFile(FileMan::openForWriting(zMapName));
+	AutoSGPFile hFile(OpenSectorTempFileForWriting(SF_REVEALED_STATUS_TEMP_FILE_EXISTS, sSectorX, sSectorY, bSectorZ));
 
 	//Write the revealed array to the Revealed temp file
 	FileWrite(hFile, gpRevealedMap, NUM_REVEALED_BYTES);
@@ -425,15 +416,11 @@ static void SetMapRevealedStatus(void);
 
 void LoadRevealedStatusArrayFromRevealedTempFile()
 {
-	CHAR8		zMapName[ 128 ];
-
-	GetMapTempFileName( SF_REVEALED_STATUS_TEMP_FILE_EXISTS, zMapName, gWorldSectorX, gWorldSectorY, gbWorldSectorZ );
-
 	//If the file doesnt exists, its no problem.
-	if (!GCM->doesGameResExists(zMapName)) return;
+	if (!DoesSectorTempFileExist(SF_REVEALED_STATUS_TEMP_FILE_EXISTS, gWorldSectorX, gWorldSectorY, gbWorldSectorZ)) return;
 
 	{
-		AutoSGPFile hFile(GCM->openGameResForReading(zMapName));
+		AutoSGPFile hFile(OpenSectorTempFileForReading(SF_REVEALED_STATUS_TEMP_FILE_EXISTS, gWorldSectorX, gWorldSectorY, gbWorldSectorZ));
 
 		Assert( gpRevealedMap == NULL );
 		gpRevealedMap = new UINT8[NUM_REVEALED_BYTES]{};
@@ -607,17 +594,14 @@ void AddExitGridToMapTempFile( UINT16 usGridNo, EXITGRID *pExitGrid, INT16 sSect
 BOOLEAN RemoveGraphicFromTempFile( UINT32 uiMapIndex, UINT16 usIndex, INT16 sSectorX, INT16 sSectorY, UINT8 ubSectorZ )
 try
 {
-	CHAR8		zMapName[ 128 ];
 	MODIFY_MAP *pMap;
 	BOOLEAN	fRetVal=FALSE;
 	UINT32	cnt;
 
-	GetMapTempFileName( SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, zMapName, sSectorX, sSectorY, ubSectorZ );
-
 	UINT32                  uiNumberOfElements;
 	SGP::Buffer<MODIFY_MAP> pTempArrayOfMaps;
 	{
-		AutoSGPFile hFile(GCM->openGameResForReading(zMapName));
+		AutoSGPFile hFile(OpenSectorTempFileForReading(SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, sSectorX, sSectorY, ubSectorZ));
 
 		//Get the number of elements in the file
 		uiNumberOfElements = FileGetSize(hFile) / sizeof(MODIFY_MAP);
@@ -628,7 +612,7 @@ try
 	}
 
 	//Delete the file
-	FileDelete( zMapName );
+	DeleteSectorTempFile(SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, sSectorX, sSectorY, ubSectorZ);
 
 	//Get the image type and subindex
 	const UINT32 uiType     = GetTileType(usIndex);
@@ -744,17 +728,14 @@ static void SetOpenableStructStatusFromMapTempFile(UINT32 uiMapIndex, BOOLEAN fO
 
 void ChangeStatusOfOpenableStructInUnloadedSector(UINT16 const usSectorX, UINT16 const usSectorY, INT8 const bSectorZ, UINT16 const usGridNo, BOOLEAN const fChangeToOpen)
 {
-	char map_name[128];
-	GetMapTempFileName(SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, map_name, usSectorX, usSectorY, bSectorZ);
-
 	// If the file doesn't exists, it's no problem.
-	if (!GCM->doesGameResExists(map_name)) return;
+	if (!DoesSectorTempFileExist(SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, usSectorX, usSectorY, bSectorZ)) return;
 
 	UINT32                  uiNumberOfElements;
 	SGP::Buffer<MODIFY_MAP> mm;
 	{
 		// Read the map temp file into a buffer
-		AutoSGPFile src(GCM->openGameResForReading(map_name));
+		AutoSGPFile src(OpenSectorTempFileForReading(SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, usSectorX, usSectorY, bSectorZ));
 
 		uiNumberOfElements = FileGetSize(src) / sizeof(MODIFY_MAP);
 
@@ -773,6 +754,6 @@ void ChangeStatusOfOpenableStructInUnloadedSector(UINT16 const usSectorX, UINT16
 		break;
 	}
 
-	AutoSGPFile dst(FileMan::openForWriting(map_name));
+	AutoSGPFile dst(OpenSectorTempFileForWriting(SF_MAP_MODIFICATIONS_TEMP_FILE_EXISTS, usSectorX, usSectorY, bSectorZ));
 	FileWrite(dst, mm, sizeof(*mm) * uiNumberOfElements);
 }
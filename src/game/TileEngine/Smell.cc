@@ -13,6 +13,9 @@
 #include "Game_Clock.h"
 #include "Overhead.h"
 
+#include <bitset>
+#include <vector>
+
 
 /*
  * Smell & Blood system
@@ -136,6 +139,60 @@
 }
 
 
+/* Only a handful of tiles carry smell or blood at any time, so instead of
+ * sweeping the whole world on every decay tick we remember which tiles got
+ * some.  Tiles are appended when a smell or blood byte is set and dropped
+ * again by the decay pass once their byte has become zero. */
+namespace
+{
+	struct ActiveTileSet
+	{
+		std::vector<GridNo>    tiles;
+		std::bitset<WORLD_MAX> member;
+
+		void Add(GridNo const gridno)
+		{
+			if (member.test(gridno)) return;
+			member.set(gridno);
+			tiles.push_back(gridno);
+		}
+
+		void Clear()
+		{
+			tiles.clear();
+			member.reset();
+		}
+	};
+}
+
+static ActiveTileSet g_smell_tiles;
+static ActiveTileSet g_blood_tiles;
+
+
+static void NoteSmellAndBlood(GridNo const gridno)
+{
+	MAP_ELEMENT const& me = gpWorldLevelData[gridno];
+	if (me.ubSmellInfo) g_smell_tiles.Add(gridno);
+	if (me.ubBloodInfo) g_blood_tiles.Add(gridno);
+}
+
+
+void SetBloodAndSmell(GridNo const gridno, UINT8 const blood, UINT8 const smell)
+{
+	MAP_ELEMENT& me = gpWorldLevelData[gridno];
+	me.ubBloodInfo = blood;
+	me.ubSmellInfo = smell;
+	NoteSmellAndBlood(gridno);
+}
+
+
+void ResetBloodAndSmellTiles()
+{
+	g_smell_tiles.Clear();
+	g_blood_tiles.Clear();
+}
+
+
 void RemoveBlood(GridNo const gridno, INT8 const level)
 {
 	MAP_ELEMENT& me = gpWorldLevelData[gridno];
@@ -147,21 +204,42 @@ void RemoveBlood(GridNo const gridno, INT8 const level)
 
 void DecaySmells()
 {
-	FOR_EACH_WORLD_TILE(i)
+	std::vector<GridNo>& tiles = g_smell_tiles.tiles;
+	size_t n_active = 0;
+	for (GridNo const gridno : tiles)
 	{
-		UINT8& smell = i->ubSmellInfo;
-		if (smell == 0) continue;
-		DECAY_SMELL_STRENGTH(smell);
-		// If the strength left is 0, wipe the whole byte to clear the type
-		if (SMELL_STRENGTH(smell) == 0) smell = 0;
+		UINT8& smell = gpWorldLevelData[gridno].ubSmellInfo;
+		if (smell != 0)
+		{
+			DECAY_SMELL_STRENGTH(smell);
+			// If the strength left is 0, wipe the whole byte to clear the type
+			if (SMELL_STRENGTH(smell) == 0) smell = 0;
+		}
+
+		if (smell != 0)
+		{
+			tiles[n_active++] = gridno;
+		}
+		else
+		{
+			g_smell_tiles.member.reset(gridno);
+		}
 	}
+	tiles.resize(n_active);
 }
 
 
+static bool RefreshBloodGraphic(GridNo, INT8 level);
+
+
 static void DecayBlood(void)
 {
-	FOR_EACH_WORLD_TILE(pMapElement)
+	std::vector<GridNo>& tiles = g_blood_tiles.tiles;
+	size_t n_active = 0;
+	bool   redraw   = false;
+	for (GridNo const gridno : tiles)
 	{
+		MAP_ELEMENT* const pMapElement = &gpWorldLevelData[gridno];
 		if (pMapElement->ubBloodInfo)
 		{
 			// delay blood timer!
@@ -206,12 +284,30 @@ static void DecayBlood(void)
 				{
 					SET_BLOOD_DELAY_TIME( pMapElement->ubBloodInfo );
 				}
+
+				// Tiles the player can already see get their new graphic right away,
+				// the rest is picked up by the next look (see FOV)
+				if (pMapElement->uiFlags & MAPELEMENT_REVEALED)
+				{
+					if (RefreshBloodGraphic(gridno, 0)) redraw = true;
+				}
 			}
 			// end of blood handling
 		}
 
-		// now go on to the next gridno
+		if (pMapElement->ubBloodInfo)
+		{
+			tiles[n_active++] = gridno;
+		}
+		else
+		{
+			g_blood_tiles.member.reset(gridno);
+		}
 	}
+	tiles.resize(n_active);
+
+	// One render update for the whole decay tick
+	if (redraw) SetRenderFlags(RENDER_FLAG_MARKED);
 }
 
 void DecayBloodAndSmells( UINT32 uiTime )
@@ -331,6 +427,7 @@ void DropSmell(SOLDIERTYPE& s)
 			// the simple case, dropping a smell in a location where there is none
 			SET_SMELL( pMapElement->ubSmellInfo, ubStrength, ubSmell );
 		}
+		NoteSmellAndBlood(s.sGridNo);
 	}
 	// otherwise skip dropping smell
 }
@@ -418,6 +515,7 @@ void InternalDropBlood(GridNo const gridno, INT8 const level, BloodKind const bl
 	}
 
 	me.uiFlags |= MAPELEMENT_REEVALUATEBLOOD;
+	NoteSmellAndBlood(gridno);
 
 	if (visible != -1) UpdateBloodGraphics(gridno, level);
 }
@@ -436,26 +534,35 @@ void DropBlood(SOLDIERTYPE const& s, UINT8 const strength)
 
 void UpdateBloodGraphics(GridNo const gridno, INT8 const level)
 {
-	// Based on level, type, display graphics for blood
+	if (RefreshBloodGraphic(gridno, level)) SetRenderFlags(RENDER_FLAG_MARKED);
+}
+
 
+/* Based on level, type, display graphics for blood.  Returns whether the tile
+ * needs to be redrawn; the caller is responsible for setting the render
+ * flags, so a batch of tiles only triggers one render update. */
+static bool RefreshBloodGraphic(GridNo const gridno, INT8 const level)
+{
 	// Check for blood option
-	if (!gGameSettings.fOptions[TOPTION_BLOOD_N_GORE]) return;
+	if (!gGameSettings.fOptions[TOPTION_BLOOD_N_GORE]) return false;
 
 	MAP_ELEMENT& me = gpWorldLevelData[gridno];
-	if (!(me.uiFlags & MAPELEMENT_REEVALUATEBLOOD)) return;
+	if (!(me.uiFlags & MAPELEMENT_REEVALUATEBLOOD)) return false;
 	me.uiFlags &= ~MAPELEMENT_REEVALUATEBLOOD;
 
 	if (level == 0)
 	{ // Ground
 		// Remove tile graphic if one exists.
+		bool removed = false;
 		if (LEVELNODE const* const n = TypeRangeExistsInObjectLayer(gridno, HUMANBLOOD, CREATUREBLOOD))
 		{
 			RemoveObject(gridno, n->usIndex);
+			removed = true;
 		}
 
 		// Pick new one. based on strength and randomness
 		INT8 const strength = BLOOD_FLOOR_STRENGTH(me.ubBloodInfo);
-		if (strength == 0) return;
+		if (strength == 0) return removed;
 
 		UINT16 const index     = Random(4) * 4 + 3 - strength / 2U;
 		UINT32 const type      =
@@ -466,10 +573,11 @@ void UpdateBloodGraphics(GridNo const gridno, INT8 const level)
 
 		// Update rendering
 		me.uiFlags |= MAPELEMENT_REDRAW;
-		SetRenderFlags(RENDER_FLAG_MARKED);
+		return true;
 	}
 	else
 	{ // Roof
 		// XXX no visible blood on roofs
+		return false;
 	}
 }
@@ -26,3 +26,8 @@ void DropBlood(SOLDIERTYPE const&, UINT8 strength);
 void UpdateBloodGraphics(GridNo, INT8 level);
 void RemoveBlood(GridNo, INT8 level);
 void InternalDropBlood(GridNo, INT8 level, BloodKind, UINT8 strength, INT8 visible);
+
+// Sets the raw blood and smell bytes of a tile, e.g. when restoring a sector
+void SetBloodAndSmell(GridNo, UINT8 blood, UINT8 smell);
+// Forgets all tiles with smell or blood, used when the world is trashed
+void ResetBloodAndSmellTiles();
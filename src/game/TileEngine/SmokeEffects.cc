@@ -59,6 +59,17 @@ static SMOKEEFFECT* GetFreeSmokeEffect(void)
 }
 
 
+// Drop unallocated slots from the end of the list, so the decay and save
+// loops only walk up to the last cloud which is still alive
+static void TrimSmokeEffects(void)
+{
+	while (guiNumSmokeEffects > 0 && !gSmokeEffectData[guiNumSmokeEffects - 1].fAllocated)
+	{
+		--guiNumSmokeEffects;
+	}
+}
+
+
 static SmokeEffectKind FromWorldFlagsToSmokeType(UINT8 ubWorldFlags);
 
 
@@ -427,6 +438,8 @@ void DecaySmokeEffects( UINT32 uiTime )
 		}
 	}
 
+	TrimSmokeEffects();
+
 	FOR_EACH_SMOKE_EFFECT(pSmoke)
 	{
 		if ( pSmoke->bFlags & SMOKE_EFFECT_ON_ROOF )
@@ -488,13 +501,9 @@ void LoadSmokeEffectsFromLoadGameFile(HWFILE const hFile, UINT32 const savegame_
 void SaveSmokeEffectsToMapTempFile(INT16 const sMapX, INT16 const sMapY, INT8 const bMapZ)
 {
 	UINT32	uiNumSmokeEffects=0;
-	CHAR8		zMapName[ 128 ];
-
-	//get the name of the map
-	GetMapTempFileName( SF_SMOKE_EFFECTS_TEMP_FILE_EXISTS, zMapName, sMapX, sMapY, bMapZ );
 
 	//delete file the file.
-	FileDelete( zMapName );
+	DeleteSectorTempFile(SF_SMOKE_EFFECTS_TEMP_FILE_EXISTS, sMapX, sMapY, bMapZ);
 
 	//loop through and count the number of smoke effects
 	CFOR_EACH_SMOKE_EFFECT(s) ++uiNumSmokeEffects;
@@ -507,7 +516,7 @@ void SaveSmokeEffectsToMapTempFile(INT16 const sMapX, INT16 const sMapY, INT8 co
 		return;
 	}
 
-	AutoSGPFile hFile(FileMan::openForWriting(zMapName));
+	AutoSGPFile hFile(OpenSectorTempFileForWriting(SF_SMOKE_EFFECTS_TEMP_FILE_EXISTS, sMapX, sMapY, bMapZ));
 
 	//Save the Number of Smoke Effects
 	FileWrite(hFile, &uiNumSmokeEffects, sizeof(UINT32));
@@ -524,11 +533,8 @@ void SaveSmokeEffectsToMapTempFile(INT16 const sMapX, INT16 const sMapY, INT8 co
 void LoadSmokeEffectsFromMapTempFile(INT16 const sMapX, INT16 const sMapY, INT8 const bMapZ)
 {
 	UINT32	uiCnt=0;
-	CHAR8		zMapName[ 128 ];
-
-	GetMapTempFileName( SF_SMOKE_EFFECTS_TEMP_FILE_EXISTS, zMapName, sMapX, sMapY, bMapZ );
 
-	AutoSGPFile hFile(GCM->openGameResForReading(zMapName));
+	AutoSGPFile hFile(OpenSectorTempFileForReading(SF_SMOKE_EFFECTS_TEMP_FILE_EXISTS, sMapX, sMapY, bMapZ));
 
 	//Clear out the old list
 	ResetSmokeEffects();
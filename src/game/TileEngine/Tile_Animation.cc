@@ -26,9 +26,140 @@
 #include "GameInstance.h"
 #include "Logger.h"
 
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 static ANITILE* pAniTileHead = NULL;
 
 
+/* The animated tiles wait for their next frame in a hierarchical timer wheel,
+ * so a frame only visits the tiles which are due.  The first level has a slot
+ * per millisecond of the next 256ms, the second level a slot per 256ms of the
+ * following 64s.  Whenever the first level wraps, the matching slot of the
+ * second level is spread over it. */
+#define ANI_WHEEL_BITS  8
+#define ANI_WHEEL_SLOTS (1U << ANI_WHEEL_BITS)
+#define ANI_WHEEL_MASK  (ANI_WHEEL_SLOTS - 1)
+#define ANI_WHEEL_SPAN  (ANI_WHEEL_SLOTS * ANI_WHEEL_SLOTS)
+
+static ANITILE* g_ani_wheel[2][ANI_WHEEL_SLOTS];
+static UINT32   g_ani_wheel_time; // First tick, which was not processed yet
+
+static std::vector<ANITILE*> g_due_ani_tiles;
+// Slow moving tiles animated last frame
+static std::vector<ANITILE*> g_settling_ani_tiles;
+
+// The tiles of the tile cache by gridno and level, most recent last
+static std::unordered_map<UINT32, std::vector<ANITILE*>> g_cached_ani_tiles;
+
+
+static UINT32 CachedAniTileKey(INT16 const gridno, UINT8 const level)
+{
+	return (UINT32)level << 16 | (UINT16)gridno;
+}
+
+
+static void LinkAniTile(ANITILE*& head, ANITILE* const a)
+{
+	a->pNextDue  = head;
+	a->ppPrevDue = &head;
+	if (head) head->ppPrevDue = &a->pNextDue;
+	head = a;
+}
+
+
+static void UnlinkAniTile(ANITILE* const a)
+{
+	if (!a->ppPrevDue) return;
+	*a->ppPrevDue = a->pNextDue;
+	if (a->pNextDue) a->pNextDue->ppPrevDue = a->ppPrevDue;
+	a->pNextDue  = 0;
+	a->ppPrevDue = 0;
+}
+
+
+static void InsertAniTileIntoWheel(ANITILE* const a)
+{
+	UnlinkAniTile(a);
+
+	UINT32 due = a->uiTimeDue;
+	if ((INT32)(due - g_ani_wheel_time) < 0) due = g_ani_wheel_time; // Overdue
+
+	UINT32 const ahead = due - g_ani_wheel_time;
+	if (ahead < ANI_WHEEL_SLOTS)
+	{
+		LinkAniTile(g_ani_wheel[0][due & ANI_WHEEL_MASK], a);
+	}
+	else if (ahead < ANI_WHEEL_SPAN)
+	{
+		LinkAniTile(g_ani_wheel[1][(due >> ANI_WHEEL_BITS) & ANI_WHEEL_MASK], a);
+	}
+	else
+	{ // Beyond the wheel, look at it again after one turn of the second level
+		UINT32 const last = (g_ani_wheel_time >> ANI_WHEEL_BITS) + ANI_WHEEL_MASK;
+		LinkAniTile(g_ani_wheel[1][last & ANI_WHEEL_MASK], a);
+	}
+}
+
+
+static void ScheduleAniTile(ANITILE* const a)
+{
+	a->uiTimeDue = a->uiTimeLastUpdate + (UINT32)a->sDelay + 1;
+	InsertAniTileIntoWheel(a);
+}
+
+
+// Puts all tiles into the wheel again, after the clock jumped
+static void RebuildAniWheel(UINT32 const now)
+{
+	std::vector<ANITILE*> tiles;
+	for (auto& level : g_ani_wheel)
+	{
+		for (ANITILE*& head : level)
+		{
+			while (head)
+			{
+				tiles.push_back(head);
+				UnlinkAniTile(head);
+			}
+		}
+	}
+
+	g_ani_wheel_time = now;
+	for (ANITILE* const a : tiles)
+	{
+		// Same test as for a due tile, the clock may have gone back
+		if (now - a->uiTimeLastUpdate > (UINT32)a->sDelay) a->uiTimeDue = now;
+		InsertAniTileIntoWheel(a);
+	}
+}
+
+
+static void CollectDueAniTiles(UINT32 const now)
+{
+	INT32 const ahead = now - g_ani_wheel_time;
+	if (ahead < -1 || ahead >= (INT32)ANI_WHEEL_SPAN) RebuildAniWheel(now);
+
+	for (; (INT32)(now - g_ani_wheel_time) >= 0; ++g_ani_wheel_time)
+	{
+		UINT32 const slot = g_ani_wheel_time & ANI_WHEEL_MASK;
+		if (slot == 0)
+		{
+			ANITILE*& upper = g_ani_wheel[1][(g_ani_wheel_time >> ANI_WHEEL_BITS) & ANI_WHEEL_MASK];
+			while (upper) InsertAniTileIntoWheel(upper);
+		}
+
+		ANITILE*& head = g_ani_wheel[0][slot];
+		while (ANITILE* const a = head)
+		{
+			UnlinkAniTile(a);
+			g_due_ani_tiles.push_back(a);
+		}
+	}
+}
+
+
 static UINT16 SetFrameByDir(UINT16 frame, const ANITILE* const a)
 {
 	if (a->uiFlags & ANITILE_USE_DIRECTION_FOR_START_FRAME)
@@ -143,6 +274,10 @@ ANITILE* CreateAnimationTile(const ANITILE_PARAMS* const parms)
 	a->sStartFrame      = start_frame;
 	a->pNext            = pAniTileHead;
 	pAniTileHead = a;
+
+	if (!(flags & ANITILE_PAUSED)) ScheduleAniTile(a);
+	if (flags & ANITILE_OPTIMIZEFORSLOWMOVING) g_settling_ani_tiles.push_back(a);
+	if (cached_tile != -1) g_cached_ani_tiles[CachedAniTileKey(gridno, ubLevel)].push_back(a);
 	return a;
 }
 
@@ -179,6 +314,10 @@ void DeleteAniTile(ANITILE* const a)
 		break;
 	}
 
+	UnlinkAniTile(a);
+	std::replace(g_due_ani_tiles.begin(), g_due_ani_tiles.end(), a, (ANITILE*)0);
+	g_settling_ani_tiles.erase(std::remove(g_settling_ani_tiles.begin(), g_settling_ani_tiles.end(), a), g_settling_ani_tiles.end());
+
 	if (a->uiFlags & ANITILE_EXISTINGTILE)
 	{
 		// update existing tile usIndex
@@ -209,7 +348,18 @@ void DeleteAniTile(ANITILE* const a)
 			case ANI_TOPMOST_LEVEL: RemoveTopmostFromLevelNode(a->sGridNo, a->pLevelNode);  break;
 		}
 
-		if (a->sCachedTileID != -1) RemoveCachedTile(a->sCachedTileID);
+		if (a->sCachedTileID != -1)
+		{
+			RemoveCachedTile(a->sCachedTileID);
+
+			auto const i = g_cached_ani_tiles.find(CachedAniTileKey(a->sGridNo, a->ubLevelID));
+			if (i != g_cached_ani_tiles.end())
+			{
+				std::vector<ANITILE*>& tiles = i->second;
+				tiles.erase(std::remove(tiles.begin(), tiles.end(), a), tiles.end());
+				if (tiles.empty()) g_cached_ani_tiles.erase(i);
+			}
+		}
 
 		if (a->uiFlags & ANITILE_EXPLOSION)
 		{
@@ -244,259 +394,295 @@ void DeleteAniTile(ANITILE* const a)
 }
 
 
-void UpdateAniTiles( )
+// Brings a slow moving tile back to the save buffer once it is not animated anymore
+static void SettleAniTile(ANITILE* const pNode)
 {
-	ANITILE *pAniNode			= NULL;
-	ANITILE *pNode				= NULL;
-	UINT32	uiClock				= GetJA2Clock( );
+	if ( pNode->uiFlags & ( ANITILE_OPTIMIZEFORSLOWMOVING ) )
+	{
+		// ONLY TURN OFF IF PAUSED...
+		if ( ( pNode->uiFlags & ANITILE_ERASEITEMFROMSAVEBUFFFER ) )
+		{
+			if ( pNode->uiFlags & ANITILE_PAUSED )
+			{
+				if ( pNode->pLevelNode->uiFlags & LEVELNODE_DYNAMIC )
+				{
+					pNode->pLevelNode->uiFlags &= (~LEVELNODE_DYNAMIC );
+					pNode->pLevelNode->uiFlags |= (LEVELNODE_LASTDYNAMIC);
+					SetRenderFlags( RENDER_FLAG_FULL );
+				}
+			}
+		}
+		else
+		{
+			pNode->pLevelNode->uiFlags &= (~LEVELNODE_DYNAMIC );
+			pNode->pLevelNode->uiFlags |= (LEVELNODE_LASTDYNAMIC);
+		}
+	}
+}
 
-	// LOOP THROUGH EACH NODE
-	pAniNode = pAniTileHead;
 
-	while( pAniNode != NULL )
+/* Advances the animation of a tile, which is due.  Returns false if the other
+ * tiles must wait for the next frame, e.g. because this one got deleted. */
+static bool AnimateAniTile(ANITILE* const pNode)
+{
+	pNode->uiTimeLastUpdate = GetJA2Clock( );
+	ScheduleAniTile(pNode);
+
+	if ( pNode->uiFlags & ( ANITILE_OPTIMIZEFORSLOWMOVING ) )
 	{
-		pNode = pAniNode;
-		pAniNode = pAniNode->pNext;
+		pNode->pLevelNode->uiFlags |= (LEVELNODE_DYNAMIC );
+		pNode->pLevelNode->uiFlags &= (~LEVELNODE_LASTDYNAMIC);
+		g_settling_ani_tiles.push_back(pNode);
+	}
 
-		if ( (uiClock - pNode->uiTimeLastUpdate ) > (UINT32)pNode->sDelay && !( pNode->uiFlags & ANITILE_PAUSED ) )
+	if ( pNode->uiFlags & ANITILE_FORWARD )
+	{
+		const UINT16 usMaxFrames = pNode->usNumFrames + SetFrameByDir(0, pNode);
+		if ( ( pNode->sCurrentFrame + 1 ) < usMaxFrames )
 		{
-			pNode->uiTimeLastUpdate = GetJA2Clock( );
+			pNode->sCurrentFrame++;
+			pNode->pLevelNode->sCurrentFrame = pNode->sCurrentFrame;
 
-			if ( pNode->uiFlags & ( ANITILE_OPTIMIZEFORSLOWMOVING ) )
+			if ( pNode->uiFlags & ANITILE_EXPLOSION )
 			{
-				pNode->pLevelNode->uiFlags |= (LEVELNODE_DYNAMIC );
-				pNode->pLevelNode->uiFlags &= (~LEVELNODE_LASTDYNAMIC);
+				// Talk to the explosion data...
+				UpdateExplosionFrame(pNode->v.explosion, pNode->sCurrentFrame);
 			}
 
-			if ( pNode->uiFlags & ANITILE_FORWARD )
+			// CHECK IF WE SHOULD BE DISPLAYING TRANSLUCENTLY!
+			if ( pNode->sCurrentFrame == pNode->ubKeyFrame1 )
 			{
-				const UINT16 usMaxFrames = pNode->usNumFrames + SetFrameByDir(0, pNode);
-				if ( ( pNode->sCurrentFrame + 1 ) < usMaxFrames )
+				switch( pNode->uiKeyFrame1Code )
 				{
-					pNode->sCurrentFrame++;
-					pNode->pLevelNode->sCurrentFrame = pNode->sCurrentFrame;
+					case ANI_KEYFRAME_BEGIN_TRANSLUCENCY:
 
-					if ( pNode->uiFlags & ANITILE_EXPLOSION )
+						pNode->pLevelNode->uiFlags |= LEVELNODE_REVEAL;
+						break;
+
+					case ANI_KEYFRAME_CHAIN_WATER_EXPLOSION:
 					{
-						// Talk to the explosion data...
-						UpdateExplosionFrame(pNode->v.explosion, pNode->sCurrentFrame);
+						const REAL_OBJECT* const o = pNode->v.object;
+						IgniteExplosionXY(o->owner, pNode->pLevelNode->sRelativeX, pNode->pLevelNode->sRelativeY, 0, pNode->sGridNo, o->Obj.usItem, 0);
+						break;
 					}
 
-					// CHECK IF WE SHOULD BE DISPLAYING TRANSLUCENTLY!
-					if ( pNode->sCurrentFrame == pNode->ubKeyFrame1 )
-					{
-						switch( pNode->uiKeyFrame1Code )
-						{
-							case ANI_KEYFRAME_BEGIN_TRANSLUCENCY:
+					case ANI_KEYFRAME_DO_SOUND:
+						PlayLocationJA2Sample(pNode->sGridNo, pNode->v.sound, MIDVOLUME, 1);
+						break;
+				}
 
-								pNode->pLevelNode->uiFlags |= LEVELNODE_REVEAL;
-								break;
+			}
 
-							case ANI_KEYFRAME_CHAIN_WATER_EXPLOSION:
-							{
-								const REAL_OBJECT* const o = pNode->v.object;
-								IgniteExplosionXY(o->owner, pNode->pLevelNode->sRelativeX, pNode->pLevelNode->sRelativeY, 0, pNode->sGridNo, o->Obj.usItem, 0);
-								break;
-							}
+			// CHECK IF WE SHOULD BE DISPLAYING TRANSLUCENTLY!
+			if ( pNode->sCurrentFrame == pNode->ubKeyFrame2 )
+			{
+				switch( pNode->uiKeyFrame2Code )
+				{
+					case ANI_KEYFRAME_BEGIN_DAMAGE:
+					{
+						Assert(pNode->uiFlags & ANITILE_EXPLOSION);
+						const EXPLOSIONTYPE* const e    = pNode->v.explosion;
+						const UINT16               item = e->usItem;
+						const UINT8 ubExpType = Explosive[GCM->getItem(item)->getClassIndex()].ubType;
 
-							case ANI_KEYFRAME_DO_SOUND:
-								PlayLocationJA2Sample(pNode->sGridNo, pNode->v.sound, MIDVOLUME, 1);
-								break;
+						if ( ubExpType == EXPLOSV_TEARGAS || ubExpType == EXPLOSV_MUSTGAS ||
+							ubExpType == EXPLOSV_SMOKE )
+						{
+							// Do sound....
+							// PlayLocationJA2Sample(pNode->sGridNo, AIR_ESCAPING_1, HIGHVOLUME, 1);
+							NewSmokeEffect(pNode->sGridNo, item, e->bLevel, e->owner);
 						}
-
-					}
-
-					// CHECK IF WE SHOULD BE DISPLAYING TRANSLUCENTLY!
-					if ( pNode->sCurrentFrame == pNode->ubKeyFrame2 )
-					{
-						switch( pNode->uiKeyFrame2Code )
+						else
 						{
-							case ANI_KEYFRAME_BEGIN_DAMAGE:
-							{
-								Assert(pNode->uiFlags & ANITILE_EXPLOSION);
-								const EXPLOSIONTYPE* const e    = pNode->v.explosion;
-								const UINT16               item = e->usItem;
-								const UINT8 ubExpType = Explosive[GCM->getItem(item)->getClassIndex()].ubType;
-
-								if ( ubExpType == EXPLOSV_TEARGAS || ubExpType == EXPLOSV_MUSTGAS ||
-									ubExpType == EXPLOSV_SMOKE )
-								{
-									// Do sound....
-									// PlayLocationJA2Sample(pNode->sGridNo, AIR_ESCAPING_1, HIGHVOLUME, 1);
-									NewSmokeEffect(pNode->sGridNo, item, e->bLevel, e->owner);
-								}
-								else
-								{
-									SpreadEffect(pNode->sGridNo, Explosive[GCM->getItem(item)->getClassIndex()].ubRadius, item, e->owner, FALSE, e->bLevel, NULL);
-								}
-								// Forfait any other animations this frame....
-								return;
-							}
+							SpreadEffect(pNode->sGridNo, Explosive[GCM->getItem(item)->getClassIndex()].ubRadius, item, e->owner, FALSE, e->bLevel, NULL);
 						}
-
+						// Forfait any other animations this frame....
+						return false;
 					}
-
 				}
-				else
-				{
-					// We are done!
-					if ( pNode->uiFlags & ANITILE_LOOPING )
-					{
-						pNode->sCurrentFrame = SetFrameByDir(pNode->sStartFrame, pNode);
-					}
-					else if ( pNode->uiFlags & ANITILE_REVERSE_LOOPING )
-					{
-						// Turn off backwards flag
-						pNode->uiFlags &= (~ANITILE_FORWARD );
-
-						// Turn onn forwards flag
-						pNode->uiFlags |= ANITILE_BACKWARD;
-					}
-					else
-					{
-						// Delete from world!
-						DeleteAniTile( pNode );
 
-						// Turn back on redunency checks!
-						gTacticalStatus.uiFlags &= (~NOHIDE_REDUNDENCY);
+			}
 
-						return;
-					}
-				}
+		}
+		else
+		{
+			// We are done!
+			if ( pNode->uiFlags & ANITILE_LOOPING )
+			{
+				pNode->sCurrentFrame = SetFrameByDir(pNode->sStartFrame, pNode);
 			}
+			else if ( pNode->uiFlags & ANITILE_REVERSE_LOOPING )
+			{
+				// Turn off backwards flag
+				pNode->uiFlags &= (~ANITILE_FORWARD );
 
-			if ( pNode->uiFlags & ANITILE_BACKWARD )
+				// Turn onn forwards flag
+				pNode->uiFlags |= ANITILE_BACKWARD;
+			}
+			else
 			{
-				if ( pNode->uiFlags & ANITILE_ERASEITEMFROMSAVEBUFFFER )
-				{
-					// ATE: Check if bounding box is on the screen...
-					if ( pNode->bFrameCountAfterStart == 0 )
-					{
-						pNode->bFrameCountAfterStart = 1;
-						pNode->pLevelNode->uiFlags |= (LEVELNODE_DYNAMIC );
+				// Delete from world!
+				DeleteAniTile( pNode );
 
-						// Dangerous here, since we may not even be on the screen...
-						SetRenderFlags( RENDER_FLAG_FULL );
+				// Turn back on redunency checks!
+				gTacticalStatus.uiFlags &= (~NOHIDE_REDUNDENCY);
 
-						continue;
-					}
-				}
+				return false;
+			}
+		}
+	}
 
-				const UINT16 usMinFrames = SetFrameByDir(0, pNode);
-				if ( ( pNode->sCurrentFrame - 1 ) >= usMinFrames )
-				{
-					pNode->sCurrentFrame--;
-					pNode->pLevelNode->sCurrentFrame = pNode->sCurrentFrame;
+	if ( pNode->uiFlags & ANITILE_BACKWARD )
+	{
+		if ( pNode->uiFlags & ANITILE_ERASEITEMFROMSAVEBUFFFER )
+		{
+			// ATE: Check if bounding box is on the screen...
+			if ( pNode->bFrameCountAfterStart == 0 )
+			{
+				pNode->bFrameCountAfterStart = 1;
+				pNode->pLevelNode->uiFlags |= (LEVELNODE_DYNAMIC );
 
-					if ( pNode->uiFlags & ANITILE_EXPLOSION )
-					{
-						// Talk to the explosion data...
-						UpdateExplosionFrame(pNode->v.explosion, pNode->sCurrentFrame);
-					}
+				// Dangerous here, since we may not even be on the screen...
+				SetRenderFlags( RENDER_FLAG_FULL );
 
-				}
-				else
-				{
-					// We are done!
-					if ( pNode->uiFlags & ANITILE_PAUSE_AFTER_LOOP )
-					{
-						// Turn off backwards flag
-						pNode->uiFlags &= (~ANITILE_BACKWARD );
+				return true;
+			}
+		}
 
-						// Pause
-						pNode->uiFlags |= ANITILE_PAUSED;
+		const UINT16 usMinFrames = SetFrameByDir(0, pNode);
+		if ( ( pNode->sCurrentFrame - 1 ) >= usMinFrames )
+		{
+			pNode->sCurrentFrame--;
+			pNode->pLevelNode->sCurrentFrame = pNode->sCurrentFrame;
 
-					}
-					else if ( pNode->uiFlags & ANITILE_LOOPING )
-					{
-						pNode->sCurrentFrame = SetFrameByDir(pNode->sStartFrame, pNode);
-					}
-					else if ( pNode->uiFlags & ANITILE_REVERSE_LOOPING )
-					{
-						// Turn off backwards flag
-						pNode->uiFlags &= (~ANITILE_BACKWARD );
+			if ( pNode->uiFlags & ANITILE_EXPLOSION )
+			{
+				// Talk to the explosion data...
+				UpdateExplosionFrame(pNode->v.explosion, pNode->sCurrentFrame);
+			}
 
-						// Turn onn forwards flag
-						pNode->uiFlags |= ANITILE_FORWARD;
-					}
-					else
-					{
-						// Delete from world!
-						DeleteAniTile( pNode );
+		}
+		else
+		{
+			// We are done!
+			if ( pNode->uiFlags & ANITILE_PAUSE_AFTER_LOOP )
+			{
+				// Turn off backwards flag
+				pNode->uiFlags &= (~ANITILE_BACKWARD );
 
-						return;
-					}
+				// Pause
+				pNode->uiFlags |= ANITILE_PAUSED;
 
-					if ( pNode->uiFlags & ANITILE_ERASEITEMFROMSAVEBUFFFER )
-					{
-						// ATE: Check if bounding box is on the screen...
-						pNode->bFrameCountAfterStart = 0;
-						//pNode->pLevelNode->uiFlags |= LEVELNODE_UPDATESAVEBUFFERONCE;
+			}
+			else if ( pNode->uiFlags & ANITILE_LOOPING )
+			{
+				pNode->sCurrentFrame = SetFrameByDir(pNode->sStartFrame, pNode);
+			}
+			else if ( pNode->uiFlags & ANITILE_REVERSE_LOOPING )
+			{
+				// Turn off backwards flag
+				pNode->uiFlags &= (~ANITILE_BACKWARD );
 
-						// Dangerous here, since we may not even be on the screen...
-						SetRenderFlags( RENDER_FLAG_FULL );
+				// Turn onn forwards flag
+				pNode->uiFlags |= ANITILE_FORWARD;
+			}
+			else
+			{
+				// Delete from world!
+				DeleteAniTile( pNode );
 
-					}
+				return false;
+			}
 
-				}
+			if ( pNode->uiFlags & ANITILE_ERASEITEMFROMSAVEBUFFFER )
+			{
+				// ATE: Check if bounding box is on the screen...
+				pNode->bFrameCountAfterStart = 0;
+				//pNode->pLevelNode->uiFlags |= LEVELNODE_UPDATESAVEBUFFERONCE;
+
+				// Dangerous here, since we may not even be on the screen...
+				SetRenderFlags( RENDER_FLAG_FULL );
 
 			}
 
 		}
-		else
+
+	}
+
+	return true;
+}
+
+
+void UpdateAniTiles( )
+{
+	UINT32 const uiClock = GetJA2Clock( );
+
+	// The slow moving tiles animated last frame are left alone from now on
+	std::vector<ANITILE*> settling;
+	settling.swap(g_settling_ani_tiles);
+	for (ANITILE* const a : settling)
+	{
+		SettleAniTile(a);
+	}
+
+	CollectDueAniTiles(uiClock);
+
+	for (size_t i = 0; i != g_due_ani_tiles.size(); ++i)
+	{
+		ANITILE* const a = g_due_ani_tiles[i];
+		if (!a) continue; // Deleted meanwhile
+		// A paused tile waits outside of the wheel until UnpauseAniTile()
+		if (a->uiFlags & ANITILE_PAUSED) continue;
+
+		if (!AnimateAniTile(a))
 		{
-			if ( pNode->uiFlags & ( ANITILE_OPTIMIZEFORSLOWMOVING ) )
+			// Forfeit the remaining tiles, they are due again next frame
+			for (++i; i != g_due_ani_tiles.size(); ++i)
 			{
-				// ONLY TURN OFF IF PAUSED...
-				if ( ( pNode->uiFlags & ANITILE_ERASEITEMFROMSAVEBUFFFER ) )
-				{
-					if ( pNode->uiFlags & ANITILE_PAUSED )
-					{
-						if ( pNode->pLevelNode->uiFlags & LEVELNODE_DYNAMIC )
-						{
-							pNode->pLevelNode->uiFlags &= (~LEVELNODE_DYNAMIC );
-							pNode->pLevelNode->uiFlags |= (LEVELNODE_LASTDYNAMIC);
-							SetRenderFlags( RENDER_FLAG_FULL );
-						}
-					}
-				}
-				else
-				{
-					pNode->pLevelNode->uiFlags &= (~LEVELNODE_DYNAMIC );
-					pNode->pLevelNode->uiFlags |= (LEVELNODE_LASTDYNAMIC);
-				}
+				ANITILE* const rest = g_due_ani_tiles[i];
+				if (rest && !(rest->uiFlags & ANITILE_PAUSED)) InsertAniTileIntoWheel(rest);
 			}
+			break;
 		}
 	}
+	g_due_ani_tiles.clear();
 }
 
 
 ANITILE* GetCachedAniTileOfType(INT16 const sGridNo, UINT8 const ubLevelID, AnimationFlags const uiFlags)
 {
-	LEVELNODE*         n;
-	MAP_ELEMENT const& me = gpWorldLevelData[sGridNo];
 	switch (ubLevelID)
 	{
-		case ANI_STRUCT_LEVEL:  n = me.pStructHead;  break;
-		case ANI_SHADOW_LEVEL:  n = me.pShadowHead;  break;
-		case ANI_OBJECT_LEVEL:  n = me.pObjectHead;  break;
-		case ANI_ROOF_LEVEL:    n = me.pRoofHead;    break;
-		case ANI_ONROOF_LEVEL:  n = me.pOnRoofHead;  break;
-		case ANI_TOPMOST_LEVEL: n = me.pTopmostHead; break;
+		case ANI_STRUCT_LEVEL:
+		case ANI_SHADOW_LEVEL:
+		case ANI_OBJECT_LEVEL:
+		case ANI_ROOF_LEVEL:
+		case ANI_ONROOF_LEVEL:
+		case ANI_TOPMOST_LEVEL:
+			break;
 		default: throw std::logic_error("Invalid level ID");
 	}
 
-	for (; n; n = n->pNext)
+	auto const i = g_cached_ani_tiles.find(CachedAniTileKey(sGridNo, ubLevelID));
+	if (i == g_cached_ani_tiles.end()) return 0;
+
+	std::vector<ANITILE*> const& tiles = i->second;
+	for (auto a = tiles.rbegin(); a != tiles.rend(); ++a)
 	{
-		if (!(n->uiFlags & LEVELNODE_CACHEDANITILE)) continue;
-		ANITILE* const a = n->pAniTile;
-		if (a->uiFlags & uiFlags) return a;
+		if ((*a)->uiFlags & uiFlags) return *a;
 	}
-
 	return 0;
 }
 
 
+void UnpauseAniTile(ANITILE* const a)
+{
+	if (!(a->uiFlags & ANITILE_PAUSED)) return;
+	a->uiFlags &= ~ANITILE_PAUSED;
+	ScheduleAniTile(a);
+}
+
+
 void HideAniTile( ANITILE *pAniTile, BOOLEAN fHide )
 {
 	if ( fHide )
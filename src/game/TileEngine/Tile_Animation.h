@@ -86,6 +86,10 @@ struct ANITILE
 
 	INT8           bFrameCountAfterStart;
 
+	// Timer wheel slot the tile waits in for its next frame
+	ANITILE*       pNextDue;
+	ANITILE**      ppPrevDue;
+	UINT32         uiTimeDue;
 };
 
 
@@ -132,6 +136,9 @@ void DeleteAniTiles(void);
 
 void HideAniTile( ANITILE *pAniTile, BOOLEAN fHide );
 
+// Clears ANITILE_PAUSED and lets the tile animate again
+void UnpauseAniTile(ANITILE*);
+
 ANITILE* GetCachedAniTileOfType(INT16 sGridNo, UINT8 ubLevelID, AnimationFlags);
 
 #endif
@@ -51,6 +51,7 @@
 #include "Overhead_Map.h"
 #include "Meanwhile.h"
 #include "SmokeEffects.h"
+#include "Smell.h"
 #include "LightEffects.h"
 #include "MemMan.h"
 #include "JAScreens.h"
@@ -2586,6 +2587,7 @@ void TrashWorld(void)
 
 	// Zero world
 	std::fill_n(gpWorldLevelData, WORLD_MAX, MAP_ELEMENT{});
+	ResetBloodAndSmellTiles();
 
 	// Set some default flags
 	FOR_EACH_WORLD_TILE(i)
@@ -10,6 +10,7 @@
 #include "Lighting.h"
 #include "RenderWorld.h"
 #include "Overhead.h"
+#include "Overhead_Map.h"
 #include "AI.h"
 #include "Animation_Control.h"
 #include "Isometric_Utils.h"
@@ -114,6 +115,8 @@ static LEVELNODE* FindTypeInLayer(LEVELNODE* const start_node, UINT32 const type
 
 LEVELNODE* AddObjectToTail(const UINT32 iMapIndex, const UINT16 usIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	LEVELNODE* const n = CreateLevelNode();
 	n->usIndex = usIndex;
 
@@ -129,6 +132,8 @@ LEVELNODE* AddObjectToTail(const UINT32 iMapIndex, const UINT16 usIndex)
 
 LEVELNODE* AddObjectToHead(const UINT32 iMapIndex, const UINT16 usIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	LEVELNODE* const n = CreateLevelNode();
 	n->usIndex = usIndex;
 
@@ -144,6 +149,8 @@ LEVELNODE* AddObjectToHead(const UINT32 iMapIndex, const UINT16 usIndex)
 
 BOOLEAN RemoveObject(UINT32 iMapIndex, UINT16 usIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	// Look through all objects and remove index if found
 	LEVELNODE* pOldObject = NULL;
 	for (LEVELNODE* pObject = gpWorldLevelData[iMapIndex].pObjectHead; pObject != NULL; pObject = pObject->pNext)
@@ -206,6 +213,8 @@ LEVELNODE* FindTypeInObjectLayer(UINT32 const map_idx, UINT32 const type)
 
 BOOLEAN RemoveAllObjectsOfTypeRange( UINT32 iMapIndex, UINT32 fStartType, UINT32 fEndType )
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	BOOLEAN fRetVal = FALSE;
 
 	// Look through all objects and Search for type
@@ -235,6 +244,8 @@ BOOLEAN RemoveAllObjectsOfTypeRange( UINT32 iMapIndex, UINT32 fStartType, UINT32
 
 LEVELNODE* AddLandToTail(const UINT32 iMapIndex, const UINT16 usIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	LEVELNODE* const n = CreateLevelNode();
 	n->usIndex = usIndex;
 
@@ -256,6 +267,8 @@ LEVELNODE* AddLandToTail(const UINT32 iMapIndex, const UINT16 usIndex)
 
 void AddLandToHead(const UINT32 iMapIndex, const UINT16 usIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	LEVELNODE* const n = CreateLevelNode();
 	n->usIndex		= usIndex;
 
@@ -287,6 +300,8 @@ void RemoveLand(UINT32 const map_idx, UINT16 const idx)
 
 static void RemoveLandEx(UINT32 iMapIndex, UINT16 usIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	// Look through all Lands and remove index if found
 	for (LEVELNODE* pLand = gpWorldLevelData[iMapIndex].pLandHead; pLand != NULL; pLand = pLand->pNext)
 	{
@@ -349,6 +364,8 @@ static BOOLEAN AdjustForFullTile(UINT32 iMapIndex)
 
 void ReplaceLandIndex(UINT32 const iMapIndex, UINT16 const usOldIndex, UINT16 const usNewIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	// Look through all Lands and remove index if found
 	for (LEVELNODE* pLand = gpWorldLevelData[iMapIndex].pLandHead; pLand != NULL; pLand = pLand->pNext)
 	{
@@ -397,6 +414,8 @@ BOOLEAN TypeRangeExistsInLandLayer(UINT32 iMapIndex, UINT32 fStartType, UINT32 f
 
 BOOLEAN RemoveAllLandsOfTypeRange( UINT32 iMapIndex, UINT32 fStartType, UINT32 fEndType )
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	const LEVELNODE* pLand = gpWorldLevelData[iMapIndex].pLandHead;
 	BOOLEAN fRetVal = FALSE;
 
@@ -424,6 +443,8 @@ BOOLEAN RemoveAllLandsOfTypeRange( UINT32 iMapIndex, UINT32 fStartType, UINT32 f
 
 void DeleteAllLandLayers(UINT32 iMapIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	const LEVELNODE* pLand = gpWorldLevelData[iMapIndex].pLandHead;
 
 	while (pLand != NULL)
@@ -441,6 +462,8 @@ void DeleteAllLandLayers(UINT32 iMapIndex)
 
 void InsertLandIndexAtLevel(const UINT32 iMapIndex, const UINT16 usIndex, const UINT8 ubLevel)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	// If we want to insert at head;
 	if (ubLevel == 0)
 	{
@@ -507,6 +530,8 @@ void RemoveHigherLandLevels(UINT32 const map_idx, UINT32 const src_type, std::ve
 
 static LEVELNODE* AddNodeToWorld(UINT32 const iMapIndex, UINT16 const usIndex, INT8 const level)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	LEVELNODE* const n = CreateLevelNode();
 	n->usIndex = usIndex;
 
@@ -669,6 +694,8 @@ static void RemoveShadowBuddy(UINT32 iMapIndex, UINT16 usIndex)
 
 void ForceRemoveStructFromTail(UINT32 const iMapIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	LEVELNODE* pPrevStruct	= NULL;
 
 	// GOTO TAIL
@@ -706,6 +733,8 @@ void ForceRemoveStructFromTail(UINT32 const iMapIndex)
 
 static void InternalRemoveStruct(UINT32 const map_idx, LEVELNODE** const anchor)
 {
+	InvalidateOverheadMapGridNo(map_idx);
+
 	LEVELNODE* const removee = *anchor;
 	*anchor = removee->pNext;
 
@@ -791,6 +820,8 @@ BOOLEAN RemoveAllStructsOfTypeRange(UINT32 iMapIndex, UINT32 fStartType, UINT32
 //  information was invalid if you changed the types, etc.  This is the bulletproof way.
 BOOLEAN ReplaceStructIndex(UINT32 iMapIndex, UINT16 usOldIndex, UINT16 usNewIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	RemoveStruct(iMapIndex, usOldIndex);
 	AddWallToStructLayer(iMapIndex, usNewIndex, FALSE);
 	return TRUE;
@@ -921,6 +952,8 @@ void HideStructOfGivenType(UINT32 const iMapIndex, UINT32 const fType, BOOLEAN c
 
 void AddShadowToTail(UINT32 const iMapIndex, UINT16 const usIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	LEVELNODE* const n = CreateLevelNode();
 	n->usIndex = usIndex;
 
@@ -950,6 +983,8 @@ void AddExclusiveShadow(UINT32 iMapIndex, UINT16 usIndex)
 
 LEVELNODE* AddShadowToHead(const UINT32 iMapIndex, const UINT16 usIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	LEVELNODE* const n = CreateLevelNode();
 	n->usIndex = usIndex;
 
@@ -965,6 +1000,8 @@ LEVELNODE* AddShadowToHead(const UINT32 iMapIndex, const UINT16 usIndex)
 
 static BOOLEAN RemoveShadow(UINT32 iMapIndex, UINT16 usIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	// Look through all shadows and remove index if found
 	LEVELNODE* pOldShadow = NULL;
 	for (LEVELNODE* pShadow = gpWorldLevelData[iMapIndex].pShadowHead; pShadow != NULL; pShadow = pShadow->pNext)
@@ -997,6 +1034,8 @@ static BOOLEAN RemoveShadow(UINT32 iMapIndex, UINT16 usIndex)
 
 BOOLEAN RemoveShadowFromLevelNode(UINT32 iMapIndex, LEVELNODE* pNode)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	LEVELNODE* pOldShadow = NULL;
 	for (LEVELNODE* pShadow = gpWorldLevelData[iMapIndex].pShadowHead; pShadow != NULL; pShadow = pShadow->pNext)
 	{
@@ -1028,6 +1067,8 @@ BOOLEAN RemoveShadowFromLevelNode(UINT32 iMapIndex, LEVELNODE* pNode)
 
 BOOLEAN RemoveAllShadowsOfTypeRange(UINT32 iMapIndex, UINT32 fStartType, UINT32 fEndType)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	BOOLEAN fRetVal = FALSE;
 
 	// Look through all shadows and Search for type
@@ -1054,6 +1095,8 @@ BOOLEAN RemoveAllShadowsOfTypeRange(UINT32 iMapIndex, UINT32 fStartType, UINT32
 
 BOOLEAN RemoveAllShadows( UINT32 iMapIndex )
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	BOOLEAN fRetVal = FALSE;
 
 	for (LEVELNODE* pShadow = gpWorldLevelData[iMapIndex].pShadowHead; pShadow != NULL;)
@@ -1258,6 +1301,8 @@ LEVELNODE* AddRoofToHead(const UINT32 iMapIndex, const UINT16 usIndex)
 
 BOOLEAN RemoveRoof(UINT32 iMapIndex, UINT16 usIndex)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	// Look through all Roofs and remove index if found
 	LEVELNODE* pOldRoof = NULL;
 	for (LEVELNODE* pRoof = gpWorldLevelData[iMapIndex].pRoofHead; pRoof != NULL; pRoof = pRoof->pNext)
@@ -1324,6 +1369,8 @@ BOOLEAN IndexExistsInRoofLayer(INT16 const sGridNo, UINT16 const usIndex)
 
 BOOLEAN RemoveAllRoofsOfTypeRange(UINT32 iMapIndex, UINT32 fStartType, UINT32 fEndType)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	BOOLEAN fRetVal = FALSE;
 
 	// Look through all Roofs and Search for type
@@ -1352,6 +1399,8 @@ BOOLEAN RemoveAllRoofsOfTypeRange(UINT32 iMapIndex, UINT32 fStartType, UINT32 fE
 
 void RemoveRoofIndexFlagsFromTypeRange(UINT32 const iMapIndex, UINT32 const fStartType, UINT32 const fEndType, LevelnodeFlags const uiFlags)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	// Look through all Roofs and Search for type
 	for (LEVELNODE* pRoof = gpWorldLevelData[iMapIndex].pRoofHead; pRoof != NULL;)
 	{
@@ -1370,6 +1419,8 @@ void RemoveRoofIndexFlagsFromTypeRange(UINT32 const iMapIndex, UINT32 const fSta
 
 void SetRoofIndexFlagsFromTypeRange(UINT32 const iMapIndex, UINT32 const fStartType, UINT32 const fEndType, LevelnodeFlags const uiFlags)
 {
+	InvalidateOverheadMapGridNo(iMapIndex);
+
 	// Look through all Roofs and Search for type
 	for (LEVELNODE* pRoof = gpWorldLevelData[iMapIndex].pRoofHead; pRoof != NULL;)
 	{
@@ -150,6 +150,12 @@ void ShutdownJA2Clock(void)
 }
 
 
+void StepJA2Clock(void)
+{
+	TimeProc(BASETIMESLICE, 0);
+}
+
+
 void PauseTime(BOOLEAN const fPaused)
 {
 	gfPauseClock = fPaused;
@@ -56,6 +56,10 @@ void ShutdownJA2Clock(void);
 
 #define GetJA2Clock() guiBaseJA2Clock
 
+/* Advances the clock by one time slice, for driving it without the timer
+ * callback, i.e. after ShutdownJA2Clock() */
+void StepJA2Clock(void);
+
 void PauseTime( BOOLEAN fPaused );
 
 void SetCustomizableTimerCallbackAndDelay( INT32 iDelay, CUSTOMIZABLE_TIMER_CALLBACK pCallback, BOOLEAN fReplace );
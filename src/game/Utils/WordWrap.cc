@@ -8,6 +8,80 @@
 
 #include <string_theory/string>
 
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+// Number of entries per cache of measured text before it is emptied
+#define TEXT_CACHE_SIZE 512
+
+
+/* Text measured with a font and a width.  The text is part of the key, so
+ * changed text is a different entry. */
+struct TextKey
+{
+	SGPFont        font;
+	UINT32         width;
+	UINT8          gap;
+	std::u32string text;
+
+	bool operator ==(TextKey const& o) const
+	{
+		return font == o.font && width == o.width && gap == o.gap && text == o.text;
+	}
+};
+
+
+struct TextKeyHash
+{
+	size_t operator ()(TextKey const& k) const
+	{
+		size_t h = std::hash<std::u32string>()(k.text);
+		h = h * 31 + std::hash<SGPFont>()(k.font);
+		h = h * 31 + (k.width << 8 | k.gap);
+		return h;
+	}
+};
+
+
+/* Results of measuring text, which are dropped when fonts get loaded or
+ * unloaded. */
+template<typename T> class TextCache
+{
+	public:
+		TextCache() : generation_(GetFontGeneration()) {}
+
+		T const* Find(TextKey const& key)
+		{
+			UINT32 const generation = GetFontGeneration();
+			if (generation_ != generation)
+			{
+				entries_.clear();
+				generation_ = generation;
+			}
+			auto const i = entries_.find(key);
+			return i != entries_.end() ? &i->second : 0;
+		}
+
+		T const& Add(TextKey const& key, T const& value)
+		{
+			if (entries_.size() >= TEXT_CACHE_SIZE) entries_.clear();
+			return entries_[key] = value;
+		}
+
+	private:
+		std::unordered_map<TextKey, T, TextKeyHash> entries_;
+		UINT32                                      generation_;
+};
+
+
+static TextKey MakeTextKey(SGPFont const font, UINT32 const width, UINT8 const gap, const ST::utf32_buffer& codepoints)
+{
+	return TextKey{ font, width, gap, std::u32string(codepoints.data(), codepoints.size()) };
+}
+
 
 static WRAPPED_STRING* AllocWrappedString(const char32_t* data, size_t size)
 {
@@ -17,12 +91,12 @@ static WRAPPED_STRING* AllocWrappedString(const char32_t* data, size_t size)
 }
 
 
-WRAPPED_STRING* LineWrap(SGPFont font, UINT16 usLineWidthPixels, const ST::utf32_buffer& codepoints)
+// Returns the start and length of each line of the wrapped text
+static std::vector<std::pair<size_t, size_t> > WrapLines(SGPFont font, UINT16 usLineWidthPixels, const ST::utf32_buffer& codepoints)
 {
 	size_t const max_w = usLineWidthPixels;
 
-	WRAPPED_STRING*  head   = 0;
-	WRAPPED_STRING** anchor = &head;
+	std::vector<std::pair<size_t, size_t> > lines;
 
 	const char32_t* i = codepoints.data();
 	while (*i == U' ') ++i; // Skip leading spaces
@@ -48,10 +122,9 @@ WRAPPED_STRING* LineWrap(SGPFont font, UINT16 usLineWidthPixels, const ST::utf32
 		{
 			if (line_start != i) // Append last line
 			{
-				WRAPPED_STRING* const ws = AllocWrappedString(line_start, i - line_start);
-				*anchor = ws;
+				lines.push_back(std::make_pair(line_start - codepoints.data(), i - line_start));
 			}
-			return head;
+			return lines;
 		}
 		size_t const w = GetCharWidth(font, *i);
 		word_w += w;
@@ -64,9 +137,7 @@ WRAPPED_STRING* LineWrap(SGPFont font, UINT16 usLineWidthPixels, const ST::utf32
 				word_start = i;
 				word_w     = 0;
 			}
-			WRAPPED_STRING* const ws = AllocWrappedString(line_start, line_end - line_start);
-			*anchor    = ws;
-			anchor     = &ws->pNextWrappedString;
+			lines.push_back(std::make_pair(line_start - codepoints.data(), line_end - line_start));
 			line_start = word_start;
 			line_end   = word_start;
 			line_w     = word_w;
@@ -81,6 +152,26 @@ WRAPPED_STRING* LineWrap(SGPFont font, UINT16 usLineWidthPixels, const ST::utf32
 }
 
 
+WRAPPED_STRING* LineWrap(SGPFont font, UINT16 usLineWidthPixels, const ST::utf32_buffer& codepoints)
+{
+	static TextCache<std::vector<std::pair<size_t, size_t> > > cache;
+
+	TextKey const key   = MakeTextKey(font, usLineWidthPixels, 0, codepoints);
+	auto          lines = cache.Find(key);
+	if (!lines) lines = &cache.Add(key, WrapLines(font, usLineWidthPixels, codepoints));
+
+	WRAPPED_STRING*  head   = 0;
+	WRAPPED_STRING** anchor = &head;
+	for (auto const& line : *lines)
+	{
+		WRAPPED_STRING* const ws = AllocWrappedString(codepoints.data() + line.first, line.second);
+		*anchor = ws;
+		anchor  = &ws->pNextWrappedString;
+	}
+	return head;
+}
+
+
 // Pass in, the x,y location for the start of the string,
 //					the width of the buffer
 //					the gap in between the lines
@@ -364,7 +455,7 @@ ST::string CleanOutControlCodesFromString(const ST::utf32_buffer& codepoints)
 
 
 // now variant for grabbing height
-UINT16 IanWrappedStringHeight(UINT16 max_w, UINT8 gap, SGPFont font, const ST::utf32_buffer& codepoints)
+static UINT16 MeasureIanWrappedStringHeight(UINT16 max_w, UINT8 gap, SGPFont font, const ST::utf32_buffer& codepoints)
 {
 	UINT16  line_w             = 0;
 	UINT16  n_lines            = 1;
@@ -458,10 +549,18 @@ UINT16 IanWrappedStringHeight(UINT16 max_w, UINT8 gap, SGPFont font, const ST::u
 }
 
 
-ST::string ReduceStringLength(const ST::utf32_buffer& codepoints, UINT32 widthToFitIn, SGPFont font)
+UINT16 IanWrappedStringHeight(UINT16 max_w, UINT8 gap, SGPFont font, const ST::utf32_buffer& codepoints)
 {
-	if (static_cast<UINT32>(StringPixLength(codepoints, font)) <= widthToFitIn) return codepoints;
+	static TextCache<UINT16> cache;
+
+	TextKey const       key = MakeTextKey(font, max_w, gap, codepoints);
+	UINT16 const* const h   = cache.Find(key);
+	return h ? *h : cache.Add(key, MeasureIanWrappedStringHeight(max_w, gap, font, codepoints));
+}
+
 
+static ST::string ShortenString(const ST::utf32_buffer& codepoints, UINT32 widthToFitIn, SGPFont font)
+{
 	const char32_t dot = U'.';
 	const UINT32 dotWidth = GetCharWidth(font, dot);
 	const size_t numDots = 3;
@@ -482,3 +581,15 @@ ST::string ReduceStringLength(const ST::utf32_buffer& codepoints, UINT32 widthTo
 	}
 	return buf;
 }
+
+
+ST::string ReduceStringLength(const ST::utf32_buffer& codepoints, UINT32 widthToFitIn, SGPFont font)
+{
+	if (static_cast<UINT32>(StringPixLength(codepoints, font)) <= widthToFitIn) return codepoints;
+
+	static TextCache<ST::string> cache;
+
+	TextKey const           key = MakeTextKey(font, widthToFitIn, 0, codepoints);
+	ST::string const* const str = cache.Find(key);
+	return str ? *str : cache.Add(key, ShortenString(codepoints, widthToFitIn, font));
+}
@@ -7,6 +7,8 @@
 #include <SDL_rwops.h>
 #include <string_theory/string>
 
+#include <algorithm>
+#include <atomic>
 #include <stdexcept>
 
 // XXX: remove FileMan class and make it into a namespace
@@ -15,6 +17,10 @@
 #define SDL_RWOPS_SGP 222
 
 
+// Calls into the Rust file functions, see FileGetRustCallCount()
+static std::atomic<uint64_t> g_file_rust_calls;
+
+
 /** Find config folder and switch into it. */
 void FileMan::switchTmpFolder(const ST::string& home)
 {
@@ -55,12 +61,108 @@ void FileDelete(const ST::string& path)
 }
 
 
+// Writes the data waiting in the buffer of a real file
+static bool WriteFileBuffer(File* const file, FileBuffer& b)
+{
+	if (!b.writing || b.end == 0) return true;
+	++g_file_rust_calls;
+	if (!File_writeAll(file, b.data.data(), b.end)) return false;
+	b.end = 0;
+	return true;
+}
+
+
+/* Moves the position of the real file to where the buffer user sees it, by
+ * writing the waiting data or giving back the data read ahead. */
+static bool SyncFileBuffer(File* const file, FileBuffer& b)
+{
+	if (b.writing) return WriteFileBuffer(file, b);
+
+	size_t const unread = b.end - b.pos;
+	b.pos = 0;
+	b.end = 0;
+	if (unread == 0) return true;
+	++g_file_rust_calls;
+	return File_seekFromCurrent(file, -(int64_t)unread) != UINT64_MAX;
+}
+
+
+static bool ReadFileBuffered(File* const file, FileBuffer& b, uint8_t* dst, size_t n)
+{
+	if (b.writing)
+	{
+		if (!WriteFileBuffer(file, b)) return false;
+		b.writing = false;
+		b.pos     = 0;
+		b.end     = 0;
+	}
+
+	for (;;)
+	{
+		size_t const n_avail = std::min(n, b.end - b.pos);
+		std::copy_n(b.data.begin() + b.pos, n_avail, dst);
+		b.pos += n_avail;
+		dst   += n_avail;
+		n     -= n_avail;
+		if (n == 0) return true;
+
+		++g_file_rust_calls;
+		// Pieces at least as big as the buffer are read directly
+		if (n >= b.data.size()) return File_readExact(file, dst, n);
+
+		size_t const n_read = File_read(file, b.data.data(), b.data.size());
+		if (n_read == 0 || n_read == SIZE_MAX) return false;
+		b.pos = 0;
+		b.end = n_read;
+	}
+}
+
+
+static bool WriteFileBuffered(File* const file, FileBuffer& b, uint8_t const* const src, size_t const n)
+{
+	if (!b.writing)
+	{
+		if (!SyncFileBuffer(file, b)) return false;
+		b.writing = true;
+	}
+
+	if (b.end + n > b.data.size())
+	{
+		if (!WriteFileBuffer(file, b)) return false;
+		// Pieces at least as big as the buffer are written directly
+		if (n >= b.data.size())
+		{
+			++g_file_rust_calls;
+			return File_writeAll(file, src, n);
+		}
+	}
+	std::copy(src, src + n, b.data.begin() + b.end);
+	b.end += n;
+	return true;
+}
+
+
 void FileClose(SGPFile* f)
 {
 	if (f->flags & SGPFILE_REAL)
 	{
+		if (f->buf)
+		{
+			if (!SyncFileBuffer(f->u.file, *f->buf))
+			{
+				RustPointer<char> err{getRustError()};
+				SLOGE(ST::format("FileClose: {}", err.get()));
+			}
+			delete f->buf;
+		}
+		++g_file_rust_calls;
 		File_close(f->u.file);
 	}
+	else if (f->flags & SGPFILE_MEMORY)
+	{
+		if (f->u.mem->owned) delete f->u.mem->data;
+		delete f->u.mem;
+	}
 	else
 	{
 		LibraryFile_close(f->u.lib);
@@ -73,7 +175,26 @@ void FileRead(SGPFile* const f, void* const pDest, size_t const uiBytesToRead)
 	BOOLEAN ret;
 	if (f->flags & SGPFILE_REAL)
 	{
-		ret = File_readExact(f->u.file, reinterpret_cast<uint8_t*>(pDest), uiBytesToRead);
+		uint8_t* const dst = reinterpret_cast<uint8_t*>(pDest);
+		if (f->buf)
+		{
+			ret = ReadFileBuffered(f->u.file, *f->buf, dst, uiBytesToRead);
+		}
+		else
+		{
+			++g_file_rust_calls;
+			ret = File_readExact(f->u.file, dst, uiBytesToRead);
+		}
+	}
+	else if (f->flags & SGPFILE_MEMORY)
+	{
+		MemoryFile& m = *f->u.mem;
+		ret = uiBytesToRead <= m.data->size() - m.pos;
+		if (ret)
+		{
+			std::copy_n(m.data->begin() + m.pos, uiBytesToRead, static_cast<uint8_t*>(pDest));
+			m.pos += uiBytesToRead;
+		}
 	}
 	else
 	{
@@ -86,8 +207,56 @@ void FileRead(SGPFile* const f, void* const pDest, size_t const uiBytesToRead)
 
 void FileWrite(SGPFile* const f, void const* const pDest, size_t const uiBytesToWrite)
 {
+	if (f->flags & SGPFILE_MEMORY)
+	{
+		MemoryFile&    m   = *f->u.mem;
+		uint8_t const* src = static_cast<uint8_t const*>(pDest);
+		size_t   const end = m.pos + uiBytesToWrite;
+		if (end > m.data->size()) m.data->resize(end);
+		std::copy(src, src + uiBytesToWrite, m.data->begin() + m.pos);
+		m.pos = end;
+		return;
+	}
 	if (!(f->flags & SGPFILE_REAL)) throw std::logic_error("Tried to write to library file");
-	if (!File_writeAll(f->u.file, reinterpret_cast<const uint8_t*>(pDest), uiBytesToWrite)) throw std::runtime_error("Writing to file failed");
+	uint8_t const* const src = reinterpret_cast<const uint8_t*>(pDest);
+	bool ret;
+	if (f->buf)
+	{
+		ret = WriteFileBuffered(f->u.file, *f->buf, src, uiBytesToWrite);
+	}
+	else
+	{
+		++g_file_rust_calls;
+		ret = File_writeAll(f->u.file, src, uiBytesToWrite);
+	}
+	if (!ret) throw std::runtime_error("Writing to file failed");
+}
+
+void FileSetBufferSize(SGPFile* const f, size_t const buffer_size)
+{
+	if (!(f->flags & SGPFILE_REAL)) return;
+	if (f->buf && !SyncFileBuffer(f->u.file, *f->buf)) throw std::runtime_error("Writing to file failed");
+	if (buffer_size == 0)
+	{
+		delete f->buf;
+		f->buf = 0;
+		return;
+	}
+	if (!f->buf) f->buf = new FileBuffer{};
+	f->buf->data.resize(buffer_size);
+}
+
+
+void FileFlush(SGPFile* const f)
+{
+	if (!(f->flags & SGPFILE_REAL) || !f->buf) return;
+	if (!WriteFileBuffer(f->u.file, *f->buf)) throw std::runtime_error("Writing to file failed");
+}
+
+
+uint64_t FileGetRustCallCount(void)
+{
+	return g_file_rust_calls;
 }
 
 static int64_t SGPSeekRW(SDL_RWops *context, int64_t offset, int whence)
@@ -170,12 +339,30 @@ void FileSeek(SGPFile* const f, INT32 distance, FileSeekMode const how)
 	bool success;
 	if (f->flags & SGPFILE_REAL)
 	{
+		success = !f->buf || SyncFileBuffer(f->u.file, *f->buf);
+		if (success)
+		{
+			++g_file_rust_calls;
+			switch (how)
+			{
+				case FILE_SEEK_FROM_START: success = distance >= 0 && File_seekFromStart(f->u.file, static_cast<uint64_t>(distance)) != UINT64_MAX; break;
+				case FILE_SEEK_FROM_END:   success = File_seekFromEnd(f->u.file, distance) != UINT64_MAX; break;
+				default:                   success = File_seekFromCurrent(f->u.file, distance) != UINT64_MAX; break;
+			}
+		}
+	}
+	else if (f->flags & SGPFILE_MEMORY)
+	{
+		MemoryFile& m = *f->u.mem;
+		int64_t pos;
 		switch (how)
 		{
-			case FILE_SEEK_FROM_START: success = distance >= 0 && File_seekFromStart(f->u.file, static_cast<uint64_t>(distance)) != UINT64_MAX; break;
-			case FILE_SEEK_FROM_END:   success = File_seekFromEnd(f->u.file, distance) != UINT64_MAX; break;
-			default:                   success = File_seekFromCurrent(f->u.file, distance) != UINT64_MAX; break;
+			case FILE_SEEK_FROM_START: pos = distance;                           break;
+			case FILE_SEEK_FROM_END:   pos = (int64_t)m.data->size() + distance; break;
+			default:                   pos = (int64_t)m.pos + distance;         break;
 		}
+		success = 0 <= pos && pos <= (int64_t)m.data->size();
+		if (success) m.pos = pos;
 	}
 	else
 	{
@@ -187,7 +374,17 @@ void FileSeek(SGPFile* const f, INT32 distance, FileSeekMode const how)
 
 INT32 FileGetPos(const SGPFile* f)
 {
-	return f->flags & SGPFILE_REAL ? (INT32)File_seekFromCurrent(f->u.file, 0) : (INT32)LibraryFile_getPosition(f->u.lib);
+	if (f->flags & SGPFILE_MEMORY) return (INT32)f->u.mem->pos;
+	if (f->flags & SGPFILE_REAL)
+	{
+		++g_file_rust_calls;
+		INT32 pos = (INT32)File_seekFromCurrent(f->u.file, 0);
+		// The buffer is ahead of the file when writing and behind when reading
+		FileBuffer const* const b = f->buf;
+		if (b) pos += b->writing ? (INT32)b->end : -(INT32)(b->end - b->pos);
+		return pos;
+	}
+	return (INT32)LibraryFile_getPosition(f->u.lib);
 }
 
 
@@ -195,6 +392,11 @@ UINT32 FileGetSize(const SGPFile* f)
 {
 	if (f->flags & SGPFILE_REAL)
 	{
+		if (f->buf && !WriteFileBuffer(f->u.file, *f->buf))
+		{
+			throw std::runtime_error("Writing to file failed");
+		}
+		++g_file_rust_calls;
 		uint64_t len = File_len(f->u.file);
 		if (len == UINT64_MAX)
 		{
@@ -202,6 +404,10 @@ UINT32 FileGetSize(const SGPFile* f)
 		}
 		return (UINT32)len;
 	}
+	else if (f->flags & SGPFILE_MEMORY)
+	{
+		return (UINT32)f->u.mem->data->size();
+	}
 	else
 	{
 		return (UINT32)LibraryFile_getSize(f->u.lib);
@@ -303,6 +509,31 @@ SGPFile* FileMan::openForWriting(const ST::string& filename, bool truncate)
 }
 
 
+SGPFile* FileMan::openInMemory()
+{
+	SGPFile* const f = new SGPFile{};
+	f->flags = SGPFILE_MEMORY;
+	f->u.mem = new MemoryFile{new std::vector<uint8_t>(), 0, true};
+	return f;
+}
+
+
+SGPFile* FileMan::openInMemory(std::vector<uint8_t>& buffer)
+{
+	SGPFile* const f = new SGPFile{};
+	f->flags = SGPFILE_MEMORY;
+	f->u.mem = new MemoryFile{&buffer, 0, false};
+	return f;
+}
+
+
+std::vector<uint8_t>& FileGetMemoryData(SGPFile* const f)
+{
+	if (!(f->flags & SGPFILE_MEMORY)) throw std::logic_error("Tried to get the memory of a file on disk");
+	return *f->u.mem->data;
+}
+
+
 /** Open file for appending data.
  * If file doesn't exist, it will be created. */
 SGPFile* FileMan::openForAppend(const ST::string& filename)
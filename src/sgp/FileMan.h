@@ -21,6 +21,23 @@ template<typename T, typename U> static inline void FileWriteArray(SGPFile* cons
 	if (n != 0) FileWrite(f, data, sizeof(*data) * n);
 }
 
+/* Size of the buffer for files which are read or written in many small pieces,
+ * like savegames. */
+#define FILE_BUFFER_SIZE (64 * 1024)
+
+/* Buffers reads and writes of a real file, 0 makes it unbuffered.  Other files
+ * are left alone.  The buffer is kept on this side of the Rust interface, so
+ * small reads and writes do not call into Rust at all. */
+void FileSetBufferSize(SGPFile*, size_t buffer_size);
+
+/* Writes the buffered data of a real file.  FileClose() does it too, but can
+ * only log errors. */
+void FileFlush(SGPFile*);
+
+/* Number of calls into the Rust file functions made by the functions here so
+ * far, to measure what buffering saves. */
+uint64_t FileGetRustCallCount(void);
+
 void  FileSeek(SGPFile*, INT32 distance, FileSeekMode);
 INT32 FileGetPos(const SGPFile*);
 
@@ -30,6 +47,9 @@ UINT32 FileGetSize(const SGPFile*);
  * Does not affect any subdirectories! */
 void EraseDirectory(const ST::string& dirPath);
 
+/* Contents of a file opened with FileMan::openInMemory(). */
+std::vector<uint8_t>& FileGetMemoryData(SGPFile*);
+
 /* Pass in the Fileman file handle of an OPEN file and it will return..
  * - if its a Real File, the return will be the handle of the REAL file
  * - if its a LIBRARY file, the return will be null */
@@ -65,6 +85,14 @@ public:
 	/** Open file for reading. */
 	static SGPFile* openForReading(const ST::string &filename);
 
+	/** Open a file which only lives in memory, for reading and writing.
+	 * Its contents are available through FileGetMemoryData() until it is closed. */
+	static SGPFile* openInMemory();
+
+	/** Open a file in memory on a buffer which the caller keeps, for reading
+	 * and writing.  The buffer must outlive the file. */
+	static SGPFile* openInMemory(std::vector<uint8_t>& buffer);
+
 	/** Read the whole file as text. */
 	static ST::string fileReadText(SGPFile*);
 
@@ -148,6 +148,120 @@ TEST(FileManTest, ReadTextFile)
 	FileClose(forReading);
 }
 
+TEST(FileManTest, BufferedFile)
+{
+	RustPointer<TempDir> tempDir(TempDir_create());
+	ASSERT_NE(tempDir.get(), nullptr);
+	RustPointer<char> tempPath(TempDir_path(tempDir.get()));
+	ASSERT_NE(tempPath.get(), nullptr);
+	ST::string path = FileMan::joinPaths(tempPath.get(), "foo.dat");
+
+	{
+		AutoSGPFile f(FileMan::openForReadWrite(path));
+		FileSetBufferSize(f, 4);
+		FileWrite(f, "foo", 3);
+		FileWrite(f, " bar", 4);
+		EXPECT_EQ(FileGetPos(f), 7);
+		EXPECT_EQ(FileGetSize(f), 7u);
+
+		char buf[3];
+		FileSeek(f, 4, FILE_SEEK_FROM_START);
+		FileRead(f, buf, sizeof(buf));
+		EXPECT_EQ(ST::string(buf, sizeof(buf)), "bar");
+		FileSeek(f, -3, FILE_SEEK_FROM_CURRENT);
+		FileWrite(f, "baz", 3);
+		FileFlush(f);
+	}
+
+	AutoSGPFile f(FileMan::openForReading(path));
+	EXPECT_EQ(FileMan::fileReadText(f), "foo baz");
+}
+
+TEST(FileManTest, BufferedFileFlushError)
+{
+	RustPointer<TempDir> tempDir(TempDir_create());
+	ASSERT_NE(tempDir.get(), nullptr);
+	RustPointer<char> tempPath(TempDir_path(tempDir.get()));
+	ASSERT_NE(tempPath.get(), nullptr);
+	ST::string path = FileMan::joinPaths(tempPath.get(), "foo.dat");
+	{
+		AutoSGPFile f(FileMan::openForWriting(path));
+	}
+
+	// The write only fills the buffer, so the error shows up when flushing
+	AutoSGPFile f(FileMan::openForReading(path));
+	FileSetBufferSize(f, 4096);
+	FileWrite(f, "foo", 3);
+	EXPECT_THROW(FileFlush(f), std::runtime_error);
+}
+
+TEST(FileManTest, BufferedFileRustCalls)
+{
+	RustPointer<TempDir> tempDir(TempDir_create());
+	ASSERT_NE(tempDir.get(), nullptr);
+	RustPointer<char> tempPath(TempDir_path(tempDir.get()));
+	ASSERT_NE(tempPath.get(), nullptr);
+	ST::string path = FileMan::joinPaths(tempPath.get(), "foo.dat");
+
+	// The Rust file is unbuffered, so every call reading or writing data is a system call too
+	uint64_t calls[2];
+	size_t const buffer_sizes[] = { 0, 4096 };
+	for (size_t i = 0; i != lengthof(buffer_sizes); ++i)
+	{
+		uint64_t const calls_before = FileGetRustCallCount();
+		{
+			AutoSGPFile f(FileMan::openForReadWrite(path));
+			FileSetBufferSize(f, buffer_sizes[i]);
+			for (UINT32 n = 0; n != 1000; ++n) FileWrite(f, &n, sizeof(n));
+			FileSeek(f, 0, FILE_SEEK_FROM_START);
+			for (UINT32 n = 0; n != 1000; ++n)
+			{
+				UINT32 read;
+				FileRead(f, &read, sizeof(read));
+				ASSERT_EQ(read, n);
+			}
+		}
+		calls[i] = FileGetRustCallCount() - calls_before;
+	}
+	EXPECT_EQ(calls[0], 2002u); // 1000 writes, a seek, 1000 reads and closing
+	EXPECT_EQ(calls[1], 4u);    // one write, a seek, one read and closing
+}
+
+TEST(FileManTest, MemoryFile)
+{
+	AutoSGPFile f(FileMan::openInMemory());
+	FileWrite(f, "foo bar", 7);
+	EXPECT_EQ(FileGetPos(f), 7);
+	EXPECT_EQ(FileGetSize(f), 7u);
+
+	// overwrite in the middle and append
+	FileSeek(f, 4, FILE_SEEK_FROM_START);
+	FileWrite(f, "bazooka", 7);
+	EXPECT_EQ(FileGetSize(f), 11u);
+
+	char buf[11];
+	FileSeek(f, -11, FILE_SEEK_FROM_END);
+	FileRead(f, buf, sizeof(buf));
+	EXPECT_EQ(ST::string(buf, sizeof(buf)), "foo bazooka");
+	EXPECT_THROW(FileRead(f, buf, 1), std::runtime_error);
+	EXPECT_THROW(FileSeek(f, 1, FILE_SEEK_FROM_CURRENT), std::runtime_error);
+
+	std::vector<uint8_t> const& data = FileGetMemoryData(f);
+	EXPECT_EQ(std::string(data.begin(), data.end()), "foo bazooka");
+}
+
+TEST(FileManTest, MemoryFileOnBuffer)
+{
+	std::vector<uint8_t> buffer{'f', 'o', 'o'};
+	{
+		AutoSGPFile f(FileMan::openInMemory(buffer));
+		EXPECT_EQ(FileGetSize(f), 3u);
+		FileSeek(f, 0, FILE_SEEK_FROM_END);
+		FileWrite(f, "bar", 3);
+	}
+	EXPECT_EQ(std::string(buffer.begin(), buffer.end()), "foobar");
+}
+
 TEST(FileManTest, GetFileName)
 {
 	EXPECT_STREQ(FileMan::getFileName("foo.txt").c_str(),        "foo.txt");
@@ -13,8 +13,14 @@
 #include "GameRes.h"
 #include "Logger.h"
 
+#include <map>
+#include <vector>
+
 typedef UINT8 GlyphIdx;
 
+// Marks codepoints without glyph in the width tables
+#define NO_GLYPH_WIDTH 0xFFFF
+
 
 // Destination printing parameters
 SGPFont             FontDefault      = 0;
@@ -32,6 +38,16 @@ static UINT16       SaveFontForeground16 = 0;
 static UINT16       SaveFontShadow16     = 0;
 static UINT16       SaveFontBackground16 = 0;
 
+/* The width of every codepoint of the translation table per font, so measuring
+ * text does not go through the translation table and the subregions of the
+ * font for each character.  The tables are built on first use and dropped when
+ * a font is unloaded or the translation table changes. */
+static std::map<SGPFont, std::vector<UINT16> > g_glyph_widths;
+static unsigned char const*                    g_glyph_widths_table;
+static SGPFont                                 g_last_font;
+static UINT16 const*                           g_last_widths;
+static UINT32                                  g_font_generation;
+
 
 /* Sets both the foreground and the background colors of the current font. The
  * top byte of the parameter word is the background color, and the bottom byte
@@ -88,19 +104,36 @@ SGPFont LoadFontFile(const char *filename)
 {
 	SGPFont const font = AddVideoObjectFromFile(filename);
 	if (!FontDefault) FontDefault = font;
+	++g_font_generation;
 	return font;
 }
 
 
+static void DropGlyphWidths(SGPFont const font)
+{
+	g_glyph_widths.erase(font);
+	g_last_font   = 0;
+	g_last_widths = 0;
+}
+
+
 /* Deletes the video object of a particular font. Frees up the memory and
  * resources allocated for it. */
 void UnloadFont(SGPFont const font)
 {
 	Assert(font);
+	DropGlyphWidths(font);
+	++g_font_generation;
 	DeleteVideoObject(font);
 }
 
 
+UINT32 GetFontGeneration(void)
+{
+	return g_font_generation;
+}
+
+
 /* Returns the width of a given character in the font. */
 static UINT32 GetWidth(HVOBJECT const hSrcVObject, GlyphIdx const ssIndex)
 {
@@ -110,13 +143,18 @@ static UINT32 GetWidth(HVOBJECT const hSrcVObject, GlyphIdx const ssIndex)
 }
 
 
+static UINT16 const* GetGlyphWidths(SGPFont);
+
+
 /* Returns the length of a string in pixels, depending on the font given. */
 INT16 StringPixLength(const ST::utf32_buffer& codepoints, SGPFont font)
 {
+	UINT16 const* const widths = GetGlyphWidths(font);
 	UINT32 w = 0;
 	for (char32_t c : codepoints)
 	{
-		w += GetCharWidth(font, c);
+		UINT16 const cw = c < TRANSLATION_TABLE_SIZE ? widths[c] : NO_GLYPH_WIDTH;
+		w += cw != NO_GLYPH_WIDTH ? cw : GetCharWidth(font, c);
 	}
 	return w;
 }
@@ -183,8 +221,44 @@ static GlyphIdx GetGlyphIndex(char32_t c)
 }
 
 
+static UINT16 const* GetGlyphWidths(SGPFont const font)
+{
+	if (g_glyph_widths_table != TranslationTable)
+	{
+		g_glyph_widths.clear();
+		g_glyph_widths_table = TranslationTable;
+		g_last_font          = 0;
+		++g_font_generation;
+	}
+	if (font == g_last_font) return g_last_widths;
+
+	std::vector<UINT16>& widths = g_glyph_widths[font];
+	if (widths.empty())
+	{
+		widths.resize(TRANSLATION_TABLE_SIZE, NO_GLYPH_WIDTH);
+		for (char32_t c = 0; c != TRANSLATION_TABLE_SIZE; ++c)
+		{
+			// Leave invalid characters and missing glyphs to the slow path, which
+			// reports them
+			if (!IsPrintableChar(c)) continue;
+			GlyphIdx const glyph = TranslationTable[c];
+			if (glyph >= font->SubregionCount()) continue;
+			widths[c] = GetWidth(font, glyph);
+		}
+	}
+	g_last_font   = font;
+	g_last_widths = widths.data();
+	return g_last_widths;
+}
+
+
 UINT32 GetCharWidth(HVOBJECT SGPFont, char32_t c)
 {
+	if (c < TRANSLATION_TABLE_SIZE)
+	{
+		UINT16 const w = GetGlyphWidths(SGPFont)[c];
+		if (w != NO_GLYPH_WIDTH) return w;
+	}
 	return GetWidth(SGPFont, GetGlyphIndex(c));
 }
 
@@ -73,6 +73,10 @@ UINT16  GetFontHeight(SGPFont);
 void    InitializeFontManager(void);
 void    UnloadFont(SGPFont);
 
+/* Changes whenever fonts are loaded or unloaded, so cached measurements of text
+ * can be dropped. */
+UINT32  GetFontGeneration(void);
+
 UINT32 GetCharWidth(HVOBJECT SGPFont, char32_t c);
 
 INT16 StringPixLength(const ST::utf32_buffer& codepoints, SGPFont font);
@@ -1,4 +1,10 @@
+#include <algorithm>
+#include <iterator>
+#include <list>
 #include <stdexcept>
+#include <string.h>
+#include <string>
+#include <unordered_map>
 
 #include "Types.h"
 #include "Debug.h"
@@ -45,6 +51,78 @@ SGPImage* CreateImage(const char* const filename, const UINT16 fContents)
 }
 
 
+// Bytes of decoded images kept by LoadSharedImage() at most
+#define SHARED_IMAGE_BUDGET (32 * 1024 * 1024)
+
+struct SharedImage
+{
+	std::shared_ptr<SGPImage const> img;
+	size_t                          size;
+	std::list<std::string>::iterator lru;
+};
+
+static std::unordered_map<std::string, SharedImage> g_shared_images;
+static std::list<std::string>                       g_shared_image_lru; // most recently used first
+static size_t                                       g_shared_image_bytes;
+
+
+static size_t GetImageSize(SGPImage const& img)
+{
+	size_t size = img.uiAppDataSize + img.usNumberOfObjects * sizeof(ETRLEObject);
+	size += img.fFlags & IMAGE_TRLECOMPRESSED ?
+		img.uiSizePixData : img.usWidth * img.usHeight * (img.ubBitDepth / 8);
+	if (img.ubBitDepth == 8) size += 256 * (sizeof(SGPPaletteEntry) + sizeof(UINT16));
+	return size;
+}
+
+
+static void DropSharedImage(std::string const& key)
+{
+	auto const i = g_shared_images.find(key);
+	g_shared_image_bytes -= i->second.size;
+	g_shared_image_lru.erase(i->second.lru);
+	g_shared_images.erase(i);
+}
+
+
+std::shared_ptr<SGPImage const> LoadSharedImage(const char* const filename, const UINT16 fContents)
+{
+	std::string key(filename);
+	key += '#';
+	key += std::to_string(fContents);
+
+	auto const i = g_shared_images.find(key);
+	if (i != g_shared_images.end())
+	{
+		g_shared_image_lru.splice(g_shared_image_lru.begin(), g_shared_image_lru, i->second.lru);
+		return i->second.img;
+	}
+
+	std::shared_ptr<SGPImage const> const img(CreateImage(filename, fContents));
+
+	// Images in use stay alive through their references when dropped here
+	size_t const size = GetImageSize(*img);
+	if (size > SHARED_IMAGE_BUDGET / 4) return img;
+	while (g_shared_image_bytes + size > SHARED_IMAGE_BUDGET)
+	{
+		DropSharedImage(g_shared_image_lru.back());
+	}
+
+	g_shared_image_lru.push_front(key);
+	g_shared_images[key] = SharedImage{ img, size, g_shared_image_lru.begin() };
+	g_shared_image_bytes += size;
+	return img;
+}
+
+
+void ClearSharedImages(void)
+{
+	g_shared_images.clear();
+	g_shared_image_lru.clear();
+	g_shared_image_bytes = 0;
+}
+
+
 static BOOLEAN Copy8BPPImageTo8BPPBuffer(SGPImage const* const img, BYTE* const pDestBuf, UINT16 const usDestWidth, UINT16 const usDestHeight, UINT16 const usX, UINT16 const usY, SGPBox const* const src_box)
 {
 	CHECKF(usX < usDestWidth);
@@ -242,6 +320,111 @@ UINT16* Create16BPPPaletteShaded(const SGPPaletteEntry* pPalette, UINT32 rscale,
 }
 
 
+struct SharedShadeSet
+{
+	SGPPaletteEntry palette[256];
+	UINT16          scales[NUM_SHARED_SHADES][3];
+	UINT16*         shades[NUM_SHARED_SHADES];
+	UINT32          refs; // One per table handed out
+};
+
+static std::unordered_multimap<UINT32, SharedShadeSet*>   g_shade_sets; // By HashShadeSet()
+static std::unordered_map<UINT16 const*, SharedShadeSet*> g_shade_set_of_table;
+
+
+static UINT32 HashShadeSet(const SGPPaletteEntry pal[256], const UINT16 scales[NUM_SHARED_SHADES][3])
+{
+	// FNV-1a
+	UINT32 hash = 2166136261U;
+	for (size_t i = 0; i != 256; ++i)
+	{
+		hash = (hash ^ pal[i].r) * 16777619U;
+		hash = (hash ^ pal[i].g) * 16777619U;
+		hash = (hash ^ pal[i].b) * 16777619U;
+	}
+	for (size_t i = 0; i != NUM_SHARED_SHADES; ++i)
+	{
+		for (size_t j = 0; j != 3; ++j)
+		{
+			hash = (hash ^ scales[i][j]) * 16777619U;
+		}
+	}
+	return hash;
+}
+
+
+static bool ShadeSetMatches(SharedShadeSet const& set, const SGPPaletteEntry pal[256], const UINT16 scales[NUM_SHARED_SHADES][3])
+{
+	for (size_t i = 0; i != 256; ++i)
+	{
+		SGPPaletteEntry const& a = set.palette[i];
+		SGPPaletteEntry const& b = pal[i];
+		if (a.r != b.r || a.g != b.g || a.b != b.b) return false;
+	}
+	return memcmp(set.scales, scales, sizeof(set.scales)) == 0;
+}
+
+
+void CreateSharedShadedPalettes(UINT16* shades[NUM_SHARED_SHADES], const SGPPaletteEntry pal[256], const UINT16 scales[NUM_SHARED_SHADES][3])
+{
+	UINT32 const hash = HashShadeSet(pal, scales);
+
+	SharedShadeSet* set = 0;
+	auto const range = g_shade_sets.equal_range(hash);
+	for (auto i = range.first; i != range.second; ++i)
+	{
+		if (!ShadeSetMatches(*i->second, pal, scales)) continue;
+		set = i->second;
+		break;
+	}
+
+	if (!set)
+	{
+		set = new SharedShadeSet{};
+		std::copy(pal, pal + 256, set->palette);
+		memcpy(set->scales, scales, sizeof(set->scales));
+		for (size_t i = 0; i != NUM_SHARED_SHADES; ++i)
+		{
+			UINT16 const* const sl = scales[i];
+			set->shades[i] = Create16BPPPaletteShaded(pal, sl[0], sl[1], sl[2], i == 0);
+			g_shade_set_of_table[set->shades[i]] = set;
+		}
+		g_shade_sets.insert(std::make_pair(hash, set));
+	}
+
+	set->refs += NUM_SHARED_SHADES;
+	std::copy(std::begin(set->shades), std::end(set->shades), shades);
+}
+
+
+void Free16BPPPalette(UINT16* const table)
+{
+	auto const i = g_shade_set_of_table.find(table);
+	if (i == g_shade_set_of_table.end())
+	{
+		delete[] table;
+		return;
+	}
+
+	SharedShadeSet* const set = i->second;
+	if (--set->refs != 0) return;
+
+	auto const range = g_shade_sets.equal_range(HashShadeSet(set->palette, set->scales));
+	for (auto k = range.first; k != range.second; ++k)
+	{
+		if (k->second != set) continue;
+		g_shade_sets.erase(k);
+		break;
+	}
+	for (UINT16* const t : set->shades)
+	{
+		g_shade_set_of_table.erase(t);
+		delete[] t;
+	}
+	delete set;
+}
+
+
 // Convert from RGB to 16 bit value
 UINT16 Get16BPPColor( UINT32 RGBValue )
 {
@@ -355,4 +538,40 @@ TEST(HImage, asserts)
 	EXPECT_EQ(sizeof(SGPPaletteEntry), 4u);
 }
 
+TEST(HImage, sharedShadedPalettes)
+{
+	SGPPaletteEntry pal[256] = {};
+	pal[1].r = 200;
+	UINT16 scales[NUM_SHARED_SHADES][3] = {};
+	for (size_t i = 0; i != NUM_SHARED_SHADES; ++i)
+	{
+		scales[i][0] = scales[i][1] = scales[i][2] = 255 - 10 * i;
+	}
+
+	UINT16* a[NUM_SHARED_SHADES];
+	UINT16* b[NUM_SHARED_SHADES];
+	CreateSharedShadedPalettes(a, pal, scales);
+	CreateSharedShadedPalettes(b, pal, scales);
+	EXPECT_TRUE(std::equal(std::begin(a), std::end(a), b));
+
+	// Another palette gets its own tables
+	UINT16* c[NUM_SHARED_SHADES];
+	pal[1].r = 100;
+	CreateSharedShadedPalettes(c, pal, scales);
+	EXPECT_NE(a[0], c[0]);
+
+	// The tables stay while one owner is left
+	for (UINT16* const t : a) Free16BPPPalette(t);
+	pal[1].r = 200;
+	UINT16* d[NUM_SHARED_SHADES];
+	CreateSharedShadedPalettes(d, pal, scales);
+	EXPECT_TRUE(std::equal(std::begin(b), std::end(b), d));
+
+	for (UINT16* const t : b) Free16BPPPalette(t);
+	for (UINT16* const t : c) Free16BPPPalette(t);
+	for (UINT16* const t : d) Free16BPPPalette(t);
+	EXPECT_TRUE(g_shade_sets.empty());
+	EXPECT_TRUE(g_shade_set_of_table.empty());
+}
+
 #endif
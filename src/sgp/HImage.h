@@ -5,6 +5,8 @@
 #include "Buffer.h"
 #include "Types.h"
 
+#include <memory>
+
 // The HIMAGE module provides a common interface for managing image data. This module
 // includes:
 // - A set of data structures representing image data. Data can be 8 or 16 bpp and/or
@@ -106,6 +108,15 @@ struct SGPImage
 
 SGPImage* CreateImage(const char* ImageFile, UINT16 fContents);
 
+/* Loads an image like CreateImage(), but shares the decoded image between
+ * loads of the same file.  The most recently used images are kept up to a
+ * memory budget, so entering a screen again does not decode its images again.
+ * The shared image must not be changed. */
+std::shared_ptr<SGPImage const> LoadSharedImage(const char* ImageFile, UINT16 fContents);
+
+// Drops all images kept for LoadSharedImage()
+void ClearSharedImages(void);
+
 // This function will run the appropriate copy function based on the type of SGPImage object
 BOOLEAN CopyImageToBuffer(SGPImage const*, UINT32 fBufferType, BYTE* pDestBuf, UINT16 usDestWidth, UINT16 usDestHeight, UINT16 usX, UINT16 usY, SGPBox const* src_rect);
 
@@ -118,6 +129,17 @@ void GetETRLEImageData(SGPImage const*, ETRLEData*);
 // Used to create a 16BPP Palette from an 8 bit palette, found in himage.c
 UINT16* Create16BPPPaletteShaded(const SGPPaletteEntry* pPalette, UINT32 rscale, UINT32 gscale, UINT32 bscale, BOOLEAN mono);
 UINT16* Create16BPPPalette(const SGPPaletteEntry* pPalette);
+
+#define NUM_SHARED_SHADES 16
+
+/* Creates a set of shade tables for the palette with Create16BPPPaletteShaded()
+ * and the given scales, the first one monochrome.  Sets for equal palettes and
+ * scales are shared, so the tables must be freed with Free16BPPPalette(). */
+void CreateSharedShadedPalettes(UINT16* shades[NUM_SHARED_SHADES], const SGPPaletteEntry pal[256], const UINT16 scales[NUM_SHARED_SHADES][3]);
+
+/* Frees a 16-bit palette table.  A shared table is only released, the set it
+ * belongs to is freed along with its last table. */
+void Free16BPPPalette(UINT16* table);
 UINT16 Get16BPPColor( UINT32 RGBValue );
 UINT32 GetRGBColor( UINT16 Value16BPP );
 
@@ -2,16 +2,208 @@
 #include "SGPStrings.h"
 #include "Types.h"
 
+#include <string_theory/format>
 #include <string_theory/string>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
 #include <stdio.h>
+#include <thread>
 #if defined(_MSC_VER)
 #define vsnprintf(buf, size, format, args) vsnprintf_s(buf, size, _TRUNCATE, format, args)
 #endif
 
+/* Once the writer thread runs, messages are passed to it through a bounded
+ * lock-free queue (Vyukov's), so the logging threads never wait for the
+ * terminal or the log file.  Messages which do not fit are counted and
+ * reported later.  Errors and asserts still are written immediately, after
+ * everything queued before them. */
+#define LOG_QUEUE_SIZE 1024 // must be a power of two
+
+struct LogEntry
+{
+	std::atomic<size_t> seq;
+	LogLevel            level;
+	const char*         file;
+	ST::string          message;
+};
+
+static LogEntry            g_log_queue[LOG_QUEUE_SIZE];
+static std::atomic<size_t> g_log_enqueue_pos;
+static size_t              g_log_dequeue_pos;
+static std::atomic<UINT32> g_log_dropped;
+
+static std::atomic<int>        g_log_level(static_cast<int>(LogLevel::Info));
+static std::atomic<bool>       g_log_writer_running;
+static std::thread             g_log_writer;
+static std::mutex              g_log_write_mutex; // Serializes the consumers of the queue
+static std::mutex              g_log_wake_mutex;
+static std::condition_variable g_log_wake;
+
+// Writes a message out, the tests replace it to see what is written
+static void (*g_log_output)(LogLevel, const char*, const char*) = Logger_log;
+
+
+static bool EnqueueLogMessage(LogLevel const level, const char* const file, const ST::string& str)
+{
+	size_t pos = g_log_enqueue_pos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		LogEntry&      e    = g_log_queue[pos & (LOG_QUEUE_SIZE - 1)];
+		size_t   const seq  = e.seq.load(std::memory_order_acquire);
+		intptr_t const diff = (intptr_t)seq - (intptr_t)pos;
+		if (diff == 0)
+		{
+			if (g_log_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			{
+				e.level   = level;
+				e.file    = file;
+				e.message = str;
+				e.seq.store(pos + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (diff < 0)
+		{
+			return false; // Full
+		}
+		else
+		{
+			pos = g_log_enqueue_pos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+
+// Writes the queued messages, g_log_write_mutex must be held
+static void DrainLogQueue(void)
+{
+	UINT32 const dropped = g_log_dropped.exchange(0);
+	if (dropped != 0)
+	{
+		ST::string const msg = ST::format("{} log messages were dropped", dropped);
+		g_log_output(LogLevel::Warn, msg.c_str(), __FILE__);
+	}
+
+	for (;;)
+	{
+		size_t const pos = g_log_dequeue_pos;
+		LogEntry&    e   = g_log_queue[pos & (LOG_QUEUE_SIZE - 1)];
+		if (e.seq.load(std::memory_order_acquire) != pos + 1) break;
+
+		g_log_output(e.level, e.message.c_str(), e.file);
+		e.message = ST::string();
+		e.seq.store(pos + LOG_QUEUE_SIZE, std::memory_order_release);
+		g_log_dequeue_pos = pos + 1;
+	}
+}
+
+
+static void FlushLog(void)
+{
+	std::lock_guard<std::mutex> l(g_log_write_mutex);
+	DrainLogQueue();
+}
+
+
+static void LogWriterThread(void)
+{
+	while (g_log_writer_running)
+	{
+		{
+			std::unique_lock<std::mutex> l(g_log_wake_mutex);
+			// The producers do not take the mutex, so a wakeup may be missed
+			g_log_wake.wait_for(l, std::chrono::milliseconds(10));
+		}
+		FlushLog();
+	}
+	FlushLog();
+}
+
+
+static void ResetLogQueue(void)
+{
+	for (size_t i = 0; i != LOG_QUEUE_SIZE; ++i)
+	{
+		g_log_queue[i].seq.store(i, std::memory_order_relaxed);
+		g_log_queue[i].message = ST::string();
+	}
+	g_log_enqueue_pos = 0;
+	g_log_dequeue_pos = 0;
+	g_log_dropped     = 0;
+}
+
+
+void StartLogWriter(void)
+{
+	if (g_log_writer_running) return;
+
+	ResetLogQueue();
+	g_log_writer_running = true;
+	g_log_writer         = std::thread(LogWriterThread);
+}
+
+
+void StopLogWriter(void)
+{
+	if (!g_log_writer_running) return;
+
+	g_log_writer_running = false;
+	g_log_wake.notify_one();
+	g_log_writer.join();
+
+	/* A message may have been queued after the last look of the writer by a
+	 * thread which still saw it running */
+	FlushLog();
+}
+
+
+namespace
+{
+	// Writes out the queue when the program exits
+	struct LogWriterGuard
+	{
+		~LogWriterGuard() { StopLogWriter(); }
+	} g_log_writer_guard;
+}
+
+
+void SetLogLevel(LogLevel const level)
+{
+	g_log_level = static_cast<int>(level);
+	Logger_setLevel(level);
+}
+
+
+bool IsLogLevelEnabled(LogLevel const level)
+{
+	return static_cast<int>(level) <= g_log_level.load(std::memory_order_relaxed);
+}
+
+
 void LogMessage(bool isAssert, LogLevel level, const char* file, const ST::string& str)
 {
-	Logger_log(level, str.c_str(), file);
+	if (!g_log_writer_running)
+	{
+		g_log_output(level, str.c_str(), file);
+	}
+	else if (isAssert || level == LogLevel::Error)
+	{
+		std::lock_guard<std::mutex> l(g_log_write_mutex);
+		DrainLogQueue();
+		g_log_output(level, str.c_str(), file);
+	}
+	else if (EnqueueLogMessage(level, file, str))
+	{
+		g_log_wake.notify_one();
+	}
+	else
+	{
+		++g_log_dropped;
+	}
 
 	#ifdef ENABLE_ASSERTS
 	if (isAssert)
@@ -37,3 +229,112 @@ void LogMessage(bool isAssert, LogLevel level, const char *file, const char *for
 	}
 	LogMessage(isAssert, level, file, str);
 }
+
+
+#ifdef WITH_UNITTESTS
+#undef FAIL
+#include "gtest/gtest.h"
+
+#include <vector>
+
+static std::vector<ST::string> g_logged_messages;
+
+static void RecordLogMessage(LogLevel, const char* const message, const char*)
+{
+	g_logged_messages.push_back(message);
+}
+
+// Queues the messages without a writer thread and records what is written
+struct LogQueueTest
+{
+	LogQueueTest()
+	{
+		StopLogWriter();
+		ResetLogQueue();
+		g_logged_messages.clear();
+		g_log_output         = RecordLogMessage;
+		g_log_writer_running = true;
+	}
+
+	~LogQueueTest()
+	{
+		g_log_writer_running = false;
+		g_log_output         = Logger_log;
+	}
+};
+
+TEST(Logger, fullQueueDropsMessages)
+{
+	LogQueueTest const test;
+	for (size_t i = 0; i != LOG_QUEUE_SIZE + 5; ++i)
+	{
+		LogMessage(false, LogLevel::Info, __FILE__, ST::format("{}", i));
+	}
+	EXPECT_EQ(g_log_dropped.load(), 5u);
+	EXPECT_TRUE(g_logged_messages.empty());
+
+	FlushLog();
+	ASSERT_EQ(g_logged_messages.size(), static_cast<size_t>(LOG_QUEUE_SIZE + 1));
+	EXPECT_EQ(g_logged_messages[0], "5 log messages were dropped");
+	for (size_t i = 0; i != LOG_QUEUE_SIZE; ++i)
+	{
+		EXPECT_EQ(g_logged_messages[i + 1], ST::format("{}", i));
+	}
+	EXPECT_EQ(g_log_dropped.load(), 0u);
+}
+
+TEST(Logger, queueWrapsAround)
+{
+	LogQueueTest const test;
+	size_t n = 0;
+	for (int round = 0; round != 5; ++round)
+	{
+		for (size_t i = 0; i != LOG_QUEUE_SIZE * 3 / 4; ++i)
+		{
+			LogMessage(false, LogLevel::Info, __FILE__, ST::format("{}", n++));
+		}
+		FlushLog();
+	}
+	EXPECT_EQ(g_log_dropped.load(), 0u);
+	ASSERT_EQ(g_logged_messages.size(), n);
+	for (size_t i = 0; i != n; ++i)
+	{
+		EXPECT_EQ(g_logged_messages[i], ST::format("{}", i));
+	}
+}
+
+TEST(Logger, errorWritesQueuedMessagesFirst)
+{
+	LogQueueTest const test;
+	LogMessage(false, LogLevel::Info, __FILE__, ST::string("info"));
+	LogMessage(false, LogLevel::Warn, __FILE__, ST::string("warning"));
+	EXPECT_TRUE(g_logged_messages.empty());
+
+	LogMessage(false, LogLevel::Error, __FILE__, ST::string("error"));
+	ASSERT_EQ(g_logged_messages.size(), 3u);
+	EXPECT_EQ(g_logged_messages[0], "info");
+	EXPECT_EQ(g_logged_messages[1], "warning");
+	EXPECT_EQ(g_logged_messages[2], "error");
+}
+
+TEST(Logger, stoppingWriterWritesEverything)
+{
+	StopLogWriter();
+	g_logged_messages.clear();
+	g_log_output = RecordLogMessage;
+	StartLogWriter();
+	for (size_t i = 0; i != 100; ++i)
+	{
+		LogMessage(false, LogLevel::Info, __FILE__, ST::format("{}", i));
+	}
+	StopLogWriter();
+	g_log_output = Logger_log;
+
+	ASSERT_EQ(g_logged_messages.size(), 100u);
+	for (size_t i = 0; i != 100; ++i)
+	{
+		EXPECT_EQ(g_logged_messages[i], ST::format("{}", i));
+	}
+}
+
+#endif
@@ -8,19 +8,36 @@
 void LogMessage(bool isAssert, LogLevel level, const char* file, const ST::string& str);
 void LogMessage(bool isAssert, LogLevel level, const char *file, const char *format, ...);
 
+/** Sets the level of the messages to log, the ones above it are discarded. */
+void SetLogLevel(LogLevel level);
+
+/** Whether messages of this level are logged.  The macros below test it
+ * before the message is formatted. */
+bool IsLogLevelEnabled(LogLevel level);
+
+/** Hands the messages to a background thread for writing from now on.  Errors
+ * and asserts are still written by the calling thread. */
+void StartLogWriter(void);
+
+/** Writes the queued messages and ends the background thread. */
+void StopLogWriter(void);
+
+#define SLOG_AT(IS_ASSERT, LEVEL, FORMAT, ...) \
+	(IsLogLevelEnabled(LEVEL) ? LogMessage(IS_ASSERT, LEVEL, __FILE__, FORMAT, ##__VA_ARGS__) : (void)0)
+
 /** Print debug message macro. */
-#define SLOGD(FORMAT, ...) LogMessage(false, LogLevel::Debug, __FILE__, FORMAT, ##__VA_ARGS__)
+#define SLOGD(FORMAT, ...) SLOG_AT(false, LogLevel::Debug, FORMAT, ##__VA_ARGS__)
 
 /** Print info message macro. */
-#define SLOGI(FORMAT, ...) LogMessage(false, LogLevel::Info,  __FILE__, FORMAT, ##__VA_ARGS__)
+#define SLOGI(FORMAT, ...) SLOG_AT(false, LogLevel::Info, FORMAT, ##__VA_ARGS__)
 
 /** Print warning message macro. */
-#define SLOGW(FORMAT, ...) LogMessage(false, LogLevel::Warn, __FILE__, FORMAT, ##__VA_ARGS__)
+#define SLOGW(FORMAT, ...) SLOG_AT(false, LogLevel::Warn, FORMAT, ##__VA_ARGS__)
 
 /** Print error message macro. */
-#define SLOGE(FORMAT, ...) LogMessage(false, LogLevel::Error, __FILE__, FORMAT, ##__VA_ARGS__)
+#define SLOGE(FORMAT, ...) SLOG_AT(false, LogLevel::Error, FORMAT, ##__VA_ARGS__)
 
 /** Print error message macro. */
-#define SLOGA(FORMAT, ...) LogMessage(true, LogLevel::Error, __FILE__, FORMAT, ##__VA_ARGS__)
+#define SLOGA(FORMAT, ...) SLOG_AT(true, LogLevel::Error, FORMAT, ##__VA_ARGS__)
 
 #endif//SGP_LOGGER_H_
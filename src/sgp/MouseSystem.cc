@@ -11,7 +11,9 @@
 //
 //=================================================================================================
 
+#include <algorithm>
 #include <stdexcept>
+#include <vector>
 
 #include "Font.h"
 #include "HImage.h"
@@ -64,6 +66,18 @@ static MOUSE_REGION* MSYS_CurrRegion = NULL;
 static const INT16 gsFastHelpDelay = 600; // In timer ticks
 
 
+/* The regions are indexed by a coarse grid over the screen.  Each cell lists
+ * the regions overlapping it from the highest to the lowest priority, so only
+ * the regions of the cell under the mouse need to be tested.  Cells at the
+ * edges of the grid take everything beyond. */
+#define MSYS_GRID_CELL_SIZE 64
+#define MSYS_GRID_COLS      32
+#define MSYS_GRID_ROWS      32
+
+static std::vector<MOUSE_REGION*> MSYS_Grid[MSYS_GRID_ROWS][MSYS_GRID_COLS];
+static UINT32                     MSYS_AddCounter = 0;
+
+
 static BOOLEAN gfRefreshUpdate = FALSE;
 
 //Kris:  December 3, 1997
@@ -77,6 +91,7 @@ static BOOLEAN gfRefreshUpdate = FALSE;
 
 
 static void MSYS_TrashRegList(void);
+static void MSYS_DeleteRegionFromList(MOUSE_REGION*);
 
 
 //======================================================================================================
@@ -196,58 +211,94 @@ static void MSYS_TrashRegList(void)
 		}
 		else
 		{
-			MSYS_RegList = MSYS_RegList->next;
+			MSYS_DeleteRegionFromList(MSYS_RegList);
 		}
 	}
 }
 
 
-static void MSYS_DeleteRegionFromList(MOUSE_REGION*);
+// Returns the cell of the grid containing the screen coordinate
+static INT32 MSYS_GridCell(INT32 const pos, INT32 const n_cells)
+{
+	INT32 const cell = pos / MSYS_GRID_CELL_SIZE;
+	return cell < 0 ? 0 : cell >= n_cells ? n_cells - 1 : cell;
+}
 
 
-/* Add a region struct to the current list. The list is sorted by priority
- * levels. If two entries have the same priority level, then the latest to enter
- * the list gets the higher priority. */
-static void MSYS_AddRegionToList(MOUSE_REGION* const r)
+/* Regions of higher priority come first.  If two regions have the same
+ * priority, then the latest to be added comes first. */
+static bool MSYS_RanksBefore(MOUSE_REGION const* const a, MOUSE_REGION const* const b)
 {
-	/* If region seems to already be in list, delete it so we can re-insert the
-	 * region. */
-	MSYS_DeleteRegionFromList(r);
+	if (a->PriorityLevel != b->PriorityLevel) return a->PriorityLevel > b->PriorityLevel;
+	return a->uiAddOrder > b->uiAddOrder;
+}
 
-	MOUSE_REGION* i = MSYS_RegList;
-	if (!i)
-	{ // Empty list, so add it straight up.
-		MSYS_RegList = r;
-	}
-	else
+
+static void MSYS_AddRegionToGrid(MOUSE_REGION* const r)
+{
+	// A region with an empty area can never be hit
+	if (r->RegionBottomRightX < r->RegionTopLeftX) return;
+	if (r->RegionBottomRightY < r->RegionTopLeftY) return;
+
+	INT32 const x1 = MSYS_GridCell(r->RegionTopLeftX,     MSYS_GRID_COLS);
+	INT32 const x2 = MSYS_GridCell(r->RegionBottomRightX, MSYS_GRID_COLS);
+	INT32 const y1 = MSYS_GridCell(r->RegionTopLeftY,     MSYS_GRID_ROWS);
+	INT32 const y2 = MSYS_GridCell(r->RegionBottomRightY, MSYS_GRID_ROWS);
+	for (INT32 y = y1; y <= y2; ++y)
 	{
-		// Walk down list until we find place to insert (or at end of list)
-		for (; i->next; i = i->next)
+		for (INT32 x = x1; x <= x2; ++x)
 		{
-			if (i->PriorityLevel <= r->PriorityLevel) break;
+			std::vector<MOUSE_REGION*>& cell = MSYS_Grid[y][x];
+			cell.insert(std::upper_bound(cell.begin(), cell.end(), r, MSYS_RanksBefore), r);
 		}
+	}
+}
 
-		if (i->PriorityLevel > r->PriorityLevel)
-		{ // Add after node
-			r->prev = i;
-			r->next = i->next;
-			if (r->next) r->next->prev = r;
-			i->next = r;
-		}
-		else
-		{ // Add before node
-			r->prev = i->prev;
-			r->next = i;
-			*(r->prev ? &r->prev->next : &MSYS_RegList) = r;
-			i->prev = r;
+
+static void MSYS_DeleteRegionFromGrid(MOUSE_REGION* const r)
+{
+	if (r->RegionBottomRightX < r->RegionTopLeftX) return;
+	if (r->RegionBottomRightY < r->RegionTopLeftY) return;
+
+	INT32 const x1 = MSYS_GridCell(r->RegionTopLeftX,     MSYS_GRID_COLS);
+	INT32 const x2 = MSYS_GridCell(r->RegionBottomRightX, MSYS_GRID_COLS);
+	INT32 const y1 = MSYS_GridCell(r->RegionTopLeftY,     MSYS_GRID_ROWS);
+	INT32 const y2 = MSYS_GridCell(r->RegionBottomRightY, MSYS_GRID_ROWS);
+	for (INT32 y = y1; y <= y2; ++y)
+	{
+		for (INT32 x = x1; x <= x2; ++x)
+		{
+			std::vector<MOUSE_REGION*>& cell = MSYS_Grid[y][x];
+			cell.erase(std::remove(cell.begin(), cell.end(), r), cell.end());
 		}
 	}
 }
 
 
+/* Add a region struct to the current list.  The order of the regions is kept
+ * by the grid, so the list only tracks the existing regions. */
+static void MSYS_AddRegionToList(MOUSE_REGION* const r)
+{
+	/* If region seems to already be in list, delete it so we can re-insert the
+	 * region. */
+	MSYS_DeleteRegionFromList(r);
+
+	r->uiAddOrder = ++MSYS_AddCounter;
+	r->prev       = 0;
+	r->next       = MSYS_RegList;
+	if (r->next) r->next->prev = r;
+	MSYS_RegList = r;
+
+	MSYS_AddRegionToGrid(r);
+}
+
+
 // Removes a region from the current list.
 static void MSYS_DeleteRegionFromList(MOUSE_REGION* const r)
 {
+	if (r->uiAddOrder != 0) MSYS_DeleteRegionFromGrid(r);
+	r->uiAddOrder = 0;
+
 	MOUSE_REGION* const prev = r->prev;
 	MOUSE_REGION* const next = r->next;
 	if (prev) prev->next = next;
@@ -260,22 +311,42 @@ static void MSYS_DeleteRegionFromList(MOUSE_REGION* const r)
 }
 
 
-/* Searches the list for the highest priority region and updates its info.  It
- * also dispatches the callback functions */
-static void MSYS_UpdateMouseRegion(void)
+static std::vector<MOUSE_REGION*> const& MSYS_GridCellAtMouse(void)
+{
+	return MSYS_Grid[MSYS_GridCell(MSYS_CurrentMY, MSYS_GRID_ROWS)][MSYS_GridCell(MSYS_CurrentMX, MSYS_GRID_COLS)];
+}
+
+
+static bool MSYS_RegionContainsMouse(MOUSE_REGION const* const r)
+{
+	return
+		r->RegionTopLeftX <= MSYS_CurrentMX && MSYS_CurrentMX <= r->RegionBottomRightX &&
+		r->RegionTopLeftY <= MSYS_CurrentMY && MSYS_CurrentMY <= r->RegionBottomRightY;
+}
+
+
+// Returns the highest priority region under the mouse
+static MOUSE_REGION* MSYS_FindRegionAtMouse(void)
 {
-	MOUSE_REGION* cur;
-	for (cur = MSYS_RegList; cur != NULL; cur = cur->next)
+	for (MOUSE_REGION* const r : MSYS_GridCellAtMouse())
 	{
-		if (cur->uiFlags & (MSYS_REGION_ENABLED | MSYS_ALLOW_DISABLED_FASTHELP) &&
-			cur->RegionTopLeftX <= MSYS_CurrentMX && MSYS_CurrentMX <= cur->RegionBottomRightX &&
-			cur->RegionTopLeftY <= MSYS_CurrentMY && MSYS_CurrentMY <= cur->RegionBottomRightY)
+		if (r->uiFlags & (MSYS_REGION_ENABLED | MSYS_ALLOW_DISABLED_FASTHELP) &&
+			MSYS_RegionContainsMouse(r))
 		{
 			/* We got the right region. We don't need to check for priorities because
-			 * the whole list is sorted the right way! */
-			break;
+			 * the cell is sorted the right way! */
+			return r;
 		}
 	}
+	return NULL;
+}
+
+
+/* Searches the list for the highest priority region and updates its info.  It
+ * also dispatches the callback functions */
+static void MSYS_UpdateMouseRegion(void)
+{
+	MOUSE_REGION* const cur = MSYS_FindRegionAtMouse();
 	MSYS_CurrRegion = cur;
 
 	MOUSE_REGION* prev = MSYS_PrevRegion;
@@ -345,14 +416,19 @@ static void MSYS_UpdateMouseRegion(void)
 			{
 				/* Addition Oct 10/1997 Carter, patch for mouse cursor
 				 * start at region and find another region encompassing */
-				for (const MOUSE_REGION* i = cur->next; i != NULL; i = i->next)
+				/* The callbacks above may have changed the regions, so look the
+				 * current region up again */
+				std::vector<MOUSE_REGION*> const& cell = MSYS_GridCellAtMouse();
+				std::vector<MOUSE_REGION*>::const_iterator i = std::find(cell.begin(), cell.end(), cur);
+				if (i != cell.end()) ++i;
+				for (; i != cell.end(); ++i)
 				{
-					if (i->uiFlags & MSYS_REGION_ENABLED &&
-							i->RegionTopLeftX <= MSYS_CurrentMX && MSYS_CurrentMX <= i->RegionBottomRightX &&
-							i->RegionTopLeftY <= MSYS_CurrentMY && MSYS_CurrentMY <= i->RegionBottomRightY &&
-							i->Cursor != MSYS_NO_CURSOR)
+					MOUSE_REGION const* const r = *i;
+					if (r->uiFlags & MSYS_REGION_ENABLED &&
+							MSYS_RegionContainsMouse(r) &&
+							r->Cursor != MSYS_NO_CURSOR)
 					{
-						MSYS_SetCurrentCursor(i->Cursor);
+						MSYS_SetCurrentCursor(r->Cursor);
 						break;
 					}
 				}
@@ -573,6 +649,19 @@ void MSYS_DefineRegion(MOUSE_REGION* const r, UINT16 const tlx, UINT16 const tly
 }
 
 
+void MSYS_MoveRegion(MOUSE_REGION* const r, INT16 const tlx, INT16 const tly, INT16 const brx, INT16 const bry)
+{
+	bool const indexed = r->uiAddOrder != 0;
+	if (indexed) MSYS_DeleteRegionFromGrid(r);
+	r->RegionTopLeftX     = tlx;
+	r->RegionTopLeftY     = tly;
+	r->RegionBottomRightX = brx;
+	r->RegionBottomRightY = bry;
+	if (indexed) MSYS_AddRegionToGrid(r);
+	gfRefreshUpdate = TRUE;
+}
+
+
 void MOUSE_REGION::ChangeCursor(UINT16 const crsr)
 {
 	Cursor = crsr;
@@ -847,3 +936,53 @@ void MOUSE_REGION::AllowDisabledRegionFastHelp(bool const allow)
 		uiFlags &= ~MSYS_ALLOW_DISABLED_FASTHELP;
 	}
 }
+
+
+#ifdef WITH_UNITTESTS
+#undef FAIL
+#include "gtest/gtest.h"
+
+TEST(MouseSystem, samePriorityLatestAddedWins)
+{
+	MOUSE_REGION a{};
+	MOUSE_REGION b{};
+	MOUSE_REGION c{};
+	MSYS_DefineRegion(&a,  10,  10, 200, 200, MSYS_PRIORITY_NORMAL, MSYS_NO_CURSOR, MSYS_NO_CALLBACK, MSYS_NO_CALLBACK);
+	MSYS_DefineRegion(&b, 100, 100, 300, 300, MSYS_PRIORITY_NORMAL, MSYS_NO_CURSOR, MSYS_NO_CALLBACK, MSYS_NO_CALLBACK);
+	MSYS_DefineRegion(&c,   0,   0,  50,  50, MSYS_PRIORITY_HIGH,   MSYS_NO_CURSOR, MSYS_NO_CALLBACK, MSYS_NO_CALLBACK);
+
+	INT16 const old_x = MSYS_CurrentMX;
+	INT16 const old_y = MSYS_CurrentMY;
+
+	// Both regions span several cells, look at the overlap in another cell than their corners
+	MSYS_CurrentMX = 150;
+	MSYS_CurrentMY = 150;
+	EXPECT_EQ(MSYS_FindRegionAtMouse(), &b);
+
+	// Adding a region again makes it the latest one
+	MSYS_RemoveRegion(&a);
+	MSYS_DefineRegion(&a, 10, 10, 200, 200, MSYS_PRIORITY_NORMAL, MSYS_NO_CURSOR, MSYS_NO_CALLBACK, MSYS_NO_CALLBACK);
+	EXPECT_EQ(MSYS_FindRegionAtMouse(), &a);
+
+	// Moving a region keeps its rank
+	MSYS_MoveRegion(&b, 120, 120, 320, 320);
+	EXPECT_EQ(MSYS_FindRegionAtMouse(), &a);
+	MSYS_MoveRegion(&a, 400, 400, 500, 500);
+	EXPECT_EQ(MSYS_FindRegionAtMouse(), &b);
+
+	// Higher priority beats the order of adding
+	MSYS_CurrentMX = 20;
+	MSYS_CurrentMY = 20;
+	EXPECT_EQ(MSYS_FindRegionAtMouse(), &c);
+	MSYS_CurrentMX = 60;
+	MSYS_CurrentMY = 60;
+	EXPECT_EQ(MSYS_FindRegionAtMouse(), (MOUSE_REGION*)NULL);
+
+	MSYS_CurrentMX = old_x;
+	MSYS_CurrentMY = old_y;
+	MSYS_RemoveRegion(&c);
+	MSYS_RemoveRegion(&b);
+	MSYS_RemoveRegion(&a);
+}
+
+#endif
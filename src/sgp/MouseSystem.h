@@ -83,6 +83,7 @@ struct MOUSE_REGION
 
 	MOUSE_REGION* next; // List maintenance, do NOT touch these entries
 	MOUSE_REGION* prev;
+	UINT32        uiAddOrder; // Order of adding the region, ranks regions of the same priority
 };
 
 // Mouse region priorities
@@ -159,6 +160,11 @@ void MSYS_DefineRegion(MOUSE_REGION *region,UINT16 tlx,UINT16 tly,UINT16 brx,UIN
 					   UINT16 crsr,MOUSE_CALLBACK movecallback,MOUSE_CALLBACK buttoncallback);
 void MSYS_RemoveRegion(MOUSE_REGION *region);
 
+/* Moves a region to new screen coordinates.  Regions must not be moved by
+ * changing their coordinates directly, because the mouse system keeps them
+ * indexed by screen area. */
+void MSYS_MoveRegion(MOUSE_REGION*, INT16 tlx, INT16 tly, INT16 brx, INT16 bry);
+
 /* Set one of the user data entries in a mouse region */
 void MSYS_SetRegionUserData(MOUSE_REGION*, UINT32 index, INT32 userdata);
 
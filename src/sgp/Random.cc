@@ -36,6 +36,18 @@ struct PreRandomEngine {
 };
 static PreRandomEngine gPreRandomEngine;
 
+static void SeedRandom(std::seed_seq& seed)
+{
+	gRandomEngine = std::mt19937(seed);
+
+	// Pregenerate random numbers.
+	for (guiPreRandomIndex = 0; guiPreRandomIndex < MAX_PREGENERATED_NUMS; ++guiPreRandomIndex)
+	{
+		guiPreRandomNums[ guiPreRandomIndex ] = guiDistribution(gRandomEngine);
+	}
+	guiPreRandomIndex = 0;
+}
+
 void InitializeRandom(void)
 {
 	// Seed the pseudo-random number engine with the current time
@@ -48,14 +60,13 @@ void InitializeRandom(void)
 	UINT32 uiSeed2 = guiDistribution(randomDevice);
 
 	std::seed_seq seed = { uiSeed1, uiSeed2 };
-	gRandomEngine = std::mt19937(seed);
+	SeedRandom(seed);
+}
 
-	// Pregenerate random numbers.
-	for (guiPreRandomIndex = 0; guiPreRandomIndex < MAX_PREGENERATED_NUMS; ++guiPreRandomIndex)
-	{
-		guiPreRandomNums[ guiPreRandomIndex ] = guiDistribution(gRandomEngine);
-	}
-	guiPreRandomIndex = 0;
+void InitializeRandom(UINT32 const uiSeed)
+{
+	std::seed_seq seed = { uiSeed };
+	SeedRandom(seed);
 }
 
 /// Returns a pseudo-random integer in the range [0,uiRange).
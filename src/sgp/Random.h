@@ -5,6 +5,8 @@
 
 
 extern void InitializeRandom(void);
+// Seeds Random() and PreRandom() with a fixed value, so a run can be repeated
+extern void InitializeRandom(UINT32 uiSeed);
 extern UINT32 Random( UINT32 uiRange );
 
 //Chance( 74 ) returns TRUE 74% of the time.  If uiChance >= 100, then it will always return TRUE.
@@ -0,0 +1,16 @@
+#include "Random.h"
+
+#include <gtest/gtest.h>
+
+
+TEST(Random, seededInitializationRepeats)
+{
+	UINT32 first[8];
+	InitializeRandom(42);
+	for (UINT32& i : first) i = Random(1000000);
+	UINT32 const pre = PreRandom(1000000);
+
+	InitializeRandom(42);
+	for (UINT32 const i : first) ASSERT_EQ(Random(1000000), i);
+	ASSERT_EQ(PreRandom(1000000), pre);
+}
@@ -1,3 +1,6 @@
+#include "AIBenchmark.h" // XXX should not be used in SGP
+#include "AutoResolveSimulation.h" // XXX should not be used in SGP
+#include "StrategicBenchmark.h" // XXX should not be used in SGP
 #include "Button_System.h"
 #include "Cheats.h"
 #include "Debug.h"
@@ -169,6 +172,7 @@ static void deinitGameAndExit()
 	SLOGD("Shutting Down SDL");
 	SDL_Quit();
 
+	StopLogWriter();
 	exit(0);
 }
 
@@ -336,6 +340,7 @@ int main(int argc, char* argv[])
 		{
 			SLOGW("%s", msg.c_str());
 		}
+		StartLogWriter();
 	}
 
 	ST::string exeFolder = FileMan::getParentPath(argv[0], true);
@@ -360,7 +365,7 @@ int main(int argc, char* argv[])
 	}
 
 	if (EngineOptions_shouldStartInDebugMode(params.get())) {
-		Logger_setLevel(LogLevel::Debug);
+		SetLogLevel(LogLevel::Debug);
 		GameState::getInstance()->setDebugging(true);
 	}
 
@@ -386,6 +391,15 @@ int main(int argc, char* argv[])
 #endif
 	}
 
+	RustPointer<char> aiBenchmarkSector(EngineOptions_getAIBenchmarkSector(params.get()));
+	RustPointer<char> autoResolveSimSector(EngineOptions_getAutoResolveSimSector(params.get()));
+	UINT32 const strategicBenchmarkDays = EngineOptions_getStrategicBenchmarkDays(params.get());
+	if (aiBenchmarkSector || autoResolveSimSector || strategicBenchmarkDays != 0) {
+		// The benchmark renders nothing and plays nothing
+		SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+		SoundEnableSound(FALSE);
+	}
+
 	GameVersion version = EngineOptions_getResourceVersion(params.get());
 	setGameVersion(version);
 
@@ -547,6 +561,35 @@ int main(int argc, char* argv[])
 
 		////////////////////////////////////////////////////////////
 
+		if (aiBenchmarkSector)
+		{
+			int const exitCode = RunAIBenchmark(aiBenchmarkSector.get(),
+						EngineOptions_getAIBenchmarkTurns(params.get()),
+						EngineOptions_getAIBenchmarkSeed(params.get()));
+			delete cm;
+			GCM = NULL;
+			return exitCode;
+		}
+
+		if (autoResolveSimSector)
+		{
+			int const exitCode = RunAutoResolveSimulation(autoResolveSimSector.get(),
+						EngineOptions_getAutoResolveSimBattles(params.get()),
+						EngineOptions_getAutoResolveSimSeed(params.get()));
+			delete cm;
+			GCM = NULL;
+			return exitCode;
+		}
+
+		if (strategicBenchmarkDays != 0)
+		{
+			int const exitCode = RunStrategicBenchmark(strategicBenchmarkDays,
+						EngineOptions_getStrategicBenchmarkSeed(params.get()));
+			delete cm;
+			GCM = NULL;
+			return exitCode;
+		}
+
 		if(isEnglishVersion())
 		{
 			SetIntroType(INTRO_SPLASH);
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "sgp/AutoObj.h"
 
+#include <vector>
+
 struct SGP_FILETIME
 {
 	uint32_t Lo;
@@ -13,12 +16,31 @@ struct SGP_FILETIME
 enum SGPFileFlags
 {
 	SGPFILE_NONE = 0U,
-	SGPFILE_REAL = 1U << 0
+	SGPFILE_REAL   = 1U << 0,
+	SGPFILE_MEMORY = 1U << 1
 };
 
 struct File;
 struct LibraryFile;
 
+/* Contents of a file which only lives in memory, see FileMan::openInMemory() */
+struct MemoryFile
+{
+	std::vector<uint8_t>* data;
+	size_t                pos;
+	bool                  owned; // the data goes away with the file
+};
+
+/* Buffer of a real file, see FileSetBufferSize().  It holds either data read
+ * ahead, data[pos, end), or data waiting to be written, data[0, end). */
+struct FileBuffer
+{
+	std::vector<uint8_t> data;
+	size_t               pos;
+	size_t               end;
+	bool                 writing;
+};
+
 struct SGPFile
 {
 	SGPFileFlags flags;
@@ -26,7 +48,9 @@ struct SGPFile
 	{
 		File* file;
 		LibraryFile* lib;
+		MemoryFile* mem;
 	} u;
+	FileBuffer* buf; // only real files have one
 };
 
 enum FileSeekMode
@@ -0,0 +1,142 @@
+#include "Stretch.h"
+
+#include <stdint.h>
+#include <vector>
+
+
+/* Source column offsets and weights are computed once per pair of widths.
+ * Stretching is mostly done between the same sizes again and again, so the
+ * last tables are kept. */
+struct ColumnTable
+{
+	UINT                src_w;
+	UINT                dst_w;
+	std::vector<UINT32> offsets;
+	std::vector<UINT8>  weights; // bilinear only, 0 - 32 towards the next column
+};
+
+static ColumnTable g_nearest_columns;
+static ColumnTable g_bilinear_columns;
+
+
+static std::vector<UINT32> const& GetNearestColumns(UINT const src_w, UINT const dst_w)
+{
+	ColumnTable& t = g_nearest_columns;
+	if (t.src_w != src_w || t.dst_w != dst_w || t.offsets.size() != dst_w)
+	{
+		t.src_w = src_w;
+		t.dst_w = dst_w;
+		t.offsets.resize(dst_w);
+		for (UINT x = 0; x != dst_w; ++x)
+		{
+			t.offsets[x] = static_cast<UINT32>(static_cast<uint64_t>(x) * src_w / dst_w);
+		}
+	}
+	return t.offsets;
+}
+
+
+void StretchPixelsNearest(UINT16* dst, UINT32 const d_pitch, UINT const dst_w, UINT const dst_h, UINT16 const* const src, UINT32 const s_pitch, UINT const src_w, UINT const src_h, bool const keyed, UINT16 const key)
+{
+	if (dst_w == 0 || dst_h == 0) return;
+
+	UINT32 const* const columns = GetNearestColumns(src_w, dst_w).data();
+	for (UINT y = 0; y != dst_h; ++y, dst += d_pitch)
+	{
+		UINT16 const* const s = src + static_cast<uint64_t>(y) * src_h / dst_h * s_pitch;
+		if (keyed)
+		{
+			for (UINT x = 0; x != dst_w; ++x)
+			{
+				// Keep the destination pixel where the source has the colour key
+				UINT16 const px   = s[columns[x]];
+				UINT16 const mask = -static_cast<UINT16>(px != key);
+				dst[x] = (dst[x] & ~mask) | (px & mask);
+			}
+		}
+		else
+		{
+			for (UINT x = 0; x != dst_w; ++x) dst[x] = s[columns[x]];
+		}
+	}
+}
+
+
+/* Spreads the channels of a RGB565 pixel, so they can be multiplied by weights
+ * of up to 32 without running into each other: G goes to the upper half. */
+static inline UINT32 SpreadRGB565(UINT16 const px)
+{
+	return (px | px << 16) & 0x07E0F81F;
+}
+
+
+static inline UINT16 JoinRGB565(UINT32 const px)
+{
+	UINT32 const masked = px & 0x07E0F81F;
+	return static_cast<UINT16>(masked | masked >> 16);
+}
+
+
+static inline UINT32 Lerp(UINT32 const a, UINT32 const b, UINT32 const w)
+{
+	return ((a * (32 - w) + b * w) >> 5) & 0x07E0F81F;
+}
+
+
+// Computes the first source pixel and the weight of the next one for each destination pixel
+static void GetBilinearSamples(UINT const src_n, UINT const dst_n, std::vector<UINT32>& offsets, std::vector<UINT8>& weights)
+{
+	offsets.resize(dst_n);
+	weights.resize(dst_n);
+	for (UINT i = 0; i != dst_n; ++i)
+	{
+		// Center of the destination pixel in source pixels, in 1/32
+		int64_t pos = (static_cast<int64_t>(2 * i + 1) * src_n * 32 / dst_n - 32) / 2;
+		if (pos < 0) pos = 0;
+		UINT32 offset = static_cast<UINT32>(pos / 32);
+		UINT8  weight = static_cast<UINT8>(pos % 32);
+		if (offset >= src_n - 1)
+		{
+			offset = src_n - 1;
+			weight = 0;
+		}
+		offsets[i] = offset;
+		weights[i] = weight;
+	}
+}
+
+
+void StretchPixelsBilinear(UINT16* dst, UINT32 const d_pitch, UINT const dst_w, UINT const dst_h, UINT16 const* const src, UINT32 const s_pitch, UINT const src_w, UINT const src_h)
+{
+	if (dst_w == 0 || dst_h == 0 || src_w == 0 || src_h == 0) return;
+
+	ColumnTable& t = g_bilinear_columns;
+	if (t.src_w != src_w || t.dst_w != dst_w || t.offsets.size() != dst_w)
+	{
+		t.src_w = src_w;
+		t.dst_w = dst_w;
+		GetBilinearSamples(src_w, dst_w, t.offsets, t.weights);
+	}
+	UINT32 const* const columns = t.offsets.data();
+	UINT8  const* const col_w   = t.weights.data();
+
+	std::vector<UINT32> rows;
+	std::vector<UINT8>  row_weights;
+	GetBilinearSamples(src_h, dst_h, rows, row_weights);
+
+	for (UINT y = 0; y != dst_h; ++y, dst += d_pitch)
+	{
+		UINT16 const* const s0 = src + rows[y] * s_pitch;
+		UINT16 const* const s1 = rows[y] + 1 < src_h ? s0 + s_pitch : s0;
+		UINT32        const wy = row_weights[y];
+		for (UINT x = 0; x != dst_w; ++x)
+		{
+			UINT32 const c0 = columns[x];
+			UINT32 const c1 = c0 + 1 < src_w ? c0 + 1 : c0;
+			UINT32 const wx = col_w[x];
+			UINT32 const top    = Lerp(SpreadRGB565(s0[c0]), SpreadRGB565(s0[c1]), wx);
+			UINT32 const bottom = Lerp(SpreadRGB565(s1[c0]), SpreadRGB565(s1[c1]), wx);
+			dst[x] = JoinRGB565(Lerp(top, bottom, wy));
+		}
+	}
+}
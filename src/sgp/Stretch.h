@@ -0,0 +1,19 @@
+#ifndef STRETCH_H
+#define STRETCH_H
+
+#include "Types.h"
+
+
+/* Scalers for buffers of 16 bit RGB565 pixels, as used by
+ * BltStretchVideoSurface().  Pitches are given in pixels. */
+
+/* Scales with nearest neighbour sampling.  Destination pixel x takes source
+ * pixel x * src_w / dst_w, and the same for the rows.  If `keyed` is set,
+ * source pixels with the value `key` are not copied. */
+void StretchPixelsNearest(UINT16* dst, UINT32 d_pitch, UINT dst_w, UINT dst_h, UINT16 const* src, UINT32 s_pitch, UINT src_w, UINT src_h, bool keyed, UINT16 key);
+
+/* Scales with bilinear filtering, sampling at the pixel centers.  Colour keys
+ * are not supported, because the filter blends neighbouring pixels. */
+void StretchPixelsBilinear(UINT16* dst, UINT32 d_pitch, UINT dst_w, UINT dst_h, UINT16 const* src, UINT32 s_pitch, UINT src_w, UINT src_h);
+
+#endif
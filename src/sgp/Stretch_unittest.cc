@@ -0,0 +1,111 @@
+#include "Stretch.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+
+// The stepping of the former BltStretchVideoSurface(), which the scaler has to match
+static void ReferenceStretch(UINT16* d, UINT32 d_pitch, UINT width, UINT height, UINT16 const* os, UINT32 s_pitch, UINT dx, UINT dy, bool keyed, UINT16 key)
+{
+	UINT py = 0;
+	for (UINT iy = 0; iy < height; ++iy)
+	{
+		UINT16 const* s = os;
+		UINT px = 0;
+		for (UINT ix = 0; ix < width; ++ix)
+		{
+			if (!keyed || *s != key) *d = *s;
+			++d;
+			px += dx;
+			for (; px >= width; px -= width) ++s;
+		}
+		d += d_pitch - width;
+		py += dy;
+		for (; py >= height; py -= height) os += s_pitch;
+	}
+}
+
+
+static std::vector<UINT16> MakeSource(UINT w, UINT h, UINT32 pitch)
+{
+	std::vector<UINT16> src(pitch * h);
+	for (UINT i = 0; i != src.size(); ++i) src[i] = static_cast<UINT16>(i * 2654435761U >> 16);
+	// Some pixels with the colour key
+	for (UINT i = 0; i < src.size(); i += 7) src[i] = 0;
+	return src;
+}
+
+
+TEST(Stretch, nearestMatchesReference)
+{
+	UINT const sizes[][4] =
+	{
+		{  1,   1,   1,   1 },
+		{ 10,  10,  10,  10 },
+		{ 10,  10,  20,  20 },
+		{ 20,  20,  10,  10 },
+		{ 17,  13,  41,   7 },
+		{ 64,  48, 640, 480 },
+		{ 640, 480, 123, 77 },
+		{ 3,    5, 100, 100 },
+	};
+	for (auto const& size : sizes)
+	{
+		UINT   const sw      = size[0];
+		UINT   const sh      = size[1];
+		UINT   const dw      = size[2];
+		UINT   const dh      = size[3];
+		UINT32 const s_pitch = sw + 3;
+		UINT32 const d_pitch = dw + 5;
+		std::vector<UINT16> const src = MakeSource(sw, sh, s_pitch);
+
+		for (bool const keyed : { false, true })
+		{
+			std::vector<UINT16> expected(d_pitch * dh, 0xBEEF);
+			std::vector<UINT16> actual(d_pitch * dh, 0xBEEF);
+			ReferenceStretch(expected.data(), d_pitch, dw, dh, src.data(), s_pitch, sw, sh, keyed, 0);
+			StretchPixelsNearest(actual.data(), d_pitch, dw, dh, src.data(), s_pitch, sw, sh, keyed, 0);
+			ASSERT_EQ(expected, actual) << sw << "x" << sh << " -> " << dw << "x" << dh << (keyed ? " keyed" : "");
+		}
+	}
+}
+
+
+TEST(Stretch, nearestDoubles)
+{
+	UINT16 const src[] = { 1, 2, 3, 4 };
+	UINT16 dst[16];
+	StretchPixelsNearest(dst, 4, 4, 4, src, 2, 2, 2, false, 0);
+	UINT16 const expected[] =
+	{
+		1, 1, 2, 2,
+		1, 1, 2, 2,
+		3, 3, 4, 4,
+		3, 3, 4, 4
+	};
+	for (UINT i = 0; i != 16; ++i) EXPECT_EQ(dst[i], expected[i]);
+}
+
+
+TEST(Stretch, bilinearKeepsFlatColour)
+{
+	std::vector<UINT16> const src(9 * 7, 0x1234);
+	std::vector<UINT16>       dst(31 * 23);
+	StretchPixelsBilinear(dst.data(), 31, 31, 23, src.data(), 9, 9, 7);
+	for (UINT16 const px : dst) ASSERT_EQ(px, 0x1234);
+}
+
+
+TEST(Stretch, bilinearBlendsNeighbours)
+{
+	// White and black next to each other give grey in between
+	UINT16 const src[] = { 0xFFFF, 0x0000 };
+	UINT16 dst[4];
+	StretchPixelsBilinear(dst, 4, 4, 1, src, 2, 2, 1);
+	EXPECT_EQ(dst[0], 0xFFFF);
+	EXPECT_EQ(dst[3], 0x0000);
+	EXPECT_GT(dst[1], dst[2]);
+	EXPECT_NE(dst[1], 0xFFFF);
+	EXPECT_NE(dst[2], 0x0000);
+}
@@ -10,7 +10,11 @@
 
 #include <algorithm>
 #include <iterator>
+#include <list>
+#include <map>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 // ******************************************************************************
 //
@@ -30,6 +34,31 @@
 static SGPVObject* gpVObjectHead = 0;
 
 
+// Bytes of opacity masks kept at most, which are enough for the masks of all
+// tiles of a tactical map
+#define OPACITY_MASK_BUDGET (4 * 1024 * 1024)
+
+typedef std::pair<SGPVObject const*, UINT16> OpacityMaskKey;
+typedef std::list<std::pair<OpacityMaskKey, std::vector<UINT8> > > OpacityMaskList;
+
+static OpacityMaskList                                   g_opacity_masks; // most recently used first
+static std::map<OpacityMaskKey, OpacityMaskList::iterator> g_opacity_mask_index;
+static size_t                                            g_opacity_mask_bytes;
+
+
+static void DeleteOpacityMasks(SGPVObject const* const vo)
+{
+	auto       i   = g_opacity_mask_index.lower_bound(OpacityMaskKey(vo, 0));
+	auto const end = g_opacity_mask_index.end();
+	while (i != end && i->first.first == vo)
+	{
+		g_opacity_mask_bytes -= i->second->second.size();
+		g_opacity_masks.erase(i->second);
+		i = g_opacity_mask_index.erase(i);
+	}
+}
+
+
 SGPVObject::SGPVObject(SGPImage const* const img) :
 	flags_(),
 	palette16_(),
@@ -89,6 +118,7 @@ SGPVObject::~SGPVObject()
 		break;
 	}
 
+	DeleteOpacityMasks(this);
 	DestroyPalettes();
 
 	if (pix_data_)     delete[] pix_data_;
@@ -204,6 +234,69 @@ UINT8 SGPVObject::GetETRLEPixelValue(UINT16 const usETRLEIndex, UINT16 const usX
 }
 
 
+/* Sets a bit for every opaque pixel of the ETRLE data.  The pixels are counted
+ * through the runs the same way as by CheckVideoObjectScreenCoordinateInData(),
+ * so testing a bit gives the same answer as decoding the runs. */
+static void BuildOpacityMask(UINT8 const* src, UINT32 const width, UINT32 const height, UINT8* const mask)
+{
+	UINT32 const n_pixels = width * height;
+	UINT32       pos      = 0;
+	for (UINT32 y = height; y != 0; --y)
+	{
+		for (;;)
+		{
+			UINT8 px_count = *src++;
+			if (px_count == 0) break;
+			if (px_count & COMPRESS_TRANSPARENT)
+			{
+				px_count &= COMPRESS_RUN_MASK;
+			}
+			else
+			{
+				for (UINT32 i = pos; i != pos + px_count && i < n_pixels; ++i)
+				{
+					mask[i / 8] |= 1 << (i % 8);
+				}
+				src += px_count;
+			}
+			pos += px_count;
+		}
+	}
+}
+
+
+UINT8 const* SGPVObject::OpacityMask(UINT16 const usETRLEIndex) const
+{
+	OpacityMaskKey const key(this, usETRLEIndex);
+	auto const i = g_opacity_mask_index.find(key);
+	if (i != g_opacity_mask_index.end())
+	{
+		g_opacity_masks.splice(g_opacity_masks.begin(), g_opacity_masks, i->second);
+		return i->second->second.data();
+	}
+
+	ETRLEObject const& e    = SubregionProperties(usETRLEIndex);
+	size_t      const  size = (e.usWidth * e.usHeight + 7) / 8;
+	if (size == 0 || size > OPACITY_MASK_BUDGET / 4) return NULL;
+
+	// Make room by dropping the least recently used masks
+	while (g_opacity_mask_bytes + size > OPACITY_MASK_BUDGET)
+	{
+		OpacityMaskList::value_type const& last = g_opacity_masks.back();
+		g_opacity_mask_bytes -= last.second.size();
+		g_opacity_mask_index.erase(last.first);
+		g_opacity_masks.pop_back();
+	}
+
+	g_opacity_masks.emplace_front(key, std::vector<UINT8>(size));
+	std::vector<UINT8>& mask = g_opacity_masks.front().second;
+	BuildOpacityMask(PixData(e), e.usWidth, e.usHeight, mask.data());
+	g_opacity_mask_index.emplace(key, g_opacity_masks.begin());
+	g_opacity_mask_bytes += size;
+	return mask.data();
+}
+
+
 /* Destroys the palette tables of a video object. All memory is deallocated, and
  * the pointers set to NULL. Be careful not to try and blit this object until
  * new tables are calculated, or things WILL go boom. */
@@ -216,7 +309,7 @@ void SGPVObject::DestroyPalettes()
 		if (!p)                         continue;
 		if (palette16_ == p) palette16_ = 0;
 		*i = 0;
-		delete[] p;
+		Free16BPPPalette(p);
 	}
 
 	if (UINT16* const p = palette16_)
@@ -250,6 +343,8 @@ void InitializeVideoObjectManager(void)
 
 void ShutdownVideoObjectManager(void)
 {
+	ClearSharedImages();
+
 	while (gpVObjectHead)
 	{
 		delete gpVObjectHead;
@@ -271,8 +366,8 @@ static
 #endif
 SGPVObject* AddStandardVideoObjectFromFile(const char* const ImageFile)
 {
-	AutoSGPImage hImage(CreateImage(ImageFile, IMAGE_ALLIMAGEDATA));
-	return AddStandardVideoObjectFromHImage(hImage);
+	std::shared_ptr<SGPImage const> const img(LoadSharedImage(ImageFile, IMAGE_ALLIMAGEDATA));
+	return new SGPVObject(img.get());
 }
 
 
@@ -449,3 +544,25 @@ void PerformVideoInfoDumpIntoFile(const char* filename, BOOLEAN fAppend)
 }
 
 #endif
+
+
+#ifdef WITH_UNITTESTS
+#undef FAIL
+#include "gtest/gtest.h"
+
+TEST(VObject, BuildOpacityMask)
+{
+	// 4x3: row 0 ".##.", row 1 "####", row 2 "...."
+	UINT8 const rle[] =
+	{
+		0x81, 2, 1, 1, 0x81, 0,
+		4, 1, 1, 1, 1, 0,
+		0x84, 0
+	};
+	UINT8 mask[2] = { 0, 0 };
+	BuildOpacityMask(rle, 4, 3, mask);
+	EXPECT_EQ(mask[0], 0xF6);
+	EXPECT_EQ(mask[1], 0x00);
+}
+
+#endif
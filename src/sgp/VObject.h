@@ -53,6 +53,11 @@ class SGPVObject
 		 */
 		UINT8 GetETRLEPixelValue(UINT16 usETLREIndex, UINT16 usX, UINT16 usY) const;
 
+		/* Returns the opacity of the pixels of an ETRLE image, one bit per pixel
+		 * in row order, or NULL if the image is too big to keep a mask for.  The
+		 * masks are built on first use and only a bounded amount is cached. */
+		UINT8 const* OpacityMask(UINT16 usETRLEIndex) const;
+
 		// Deletes the 16-bit palette tables
 		void DestroyPalettes();
 
@@ -2,6 +2,7 @@
 #include "HImage.h"
 #include "MemMan.h"
 #include "Shading.h"
+#include "Stretch.h"
 #include "VObject_Blitters.h"
 #include "VSurface.h"
 #include "Video.h"
@@ -200,7 +201,7 @@ SGPVSurfaceAuto* AddVideoSurface(UINT16 Width, UINT16 Height, UINT8 BitDepth)
 
 SGPVSurfaceAuto* AddVideoSurfaceFromFile(const char* const Filename)
 {
-	AutoSGPImage img(CreateImage(Filename, IMAGE_ALLIMAGEDATA));
+	std::shared_ptr<SGPImage const> const img(LoadSharedImage(Filename, IMAGE_ALLIMAGEDATA));
 
 	SGPVSurfaceAuto* const vs = new SGPVSurfaceAuto(img->usWidth, img->usHeight, img->ubBitDepth);
 
@@ -217,7 +218,7 @@ SGPVSurfaceAuto* AddVideoSurfaceFromFile(const char* const Filename)
 		UINT8*  const dst   = l.Buffer<UINT8>();
 		UINT16  const pitch = l.Pitch() / (dst_bpp / 8); // pitch in pixels
 		SGPBox  const box   = { 0, 0, img->usWidth, img->usHeight };
-		BOOLEAN const Ret   = CopyImageToBuffer(img, buffer_bpp, dst, pitch, vs->Height(), 0, 0, &box);
+		BOOLEAN const Ret   = CopyImageToBuffer(img.get(), buffer_bpp, dst, pitch, vs->Height(), 0, 0, &box);
 		if (!Ret)
 		{
 			SLOGE("Error Occured Copying SGPImage to video surface");
@@ -363,52 +364,24 @@ void BltStretchVideoSurface(SGPVSurface* const dst, SGPVSurface const* const src
 	SDL_Surface const* const ssurface = src->surface_;
 	SDL_Surface*       const dsurface = dst->surface_;
 
-	const UINT32  s_pitch = ssurface->pitch >> 1;
-	const UINT32  d_pitch = dsurface->pitch >> 1;
-	UINT16 const* os      = (const UINT16*)ssurface->pixels + s_pitch * src_rect->y + src_rect->x;
+	UINT32  const s_pitch = ssurface->pitch >> 1;
+	UINT32  const d_pitch = dsurface->pitch >> 1;
+	UINT16 const* s       = (const UINT16*)ssurface->pixels + s_pitch * src_rect->y + src_rect->x;
 	UINT16*       d       =       (UINT16*)dsurface->pixels + d_pitch * dst_rect->y + dst_rect->x;
 
-	UINT const width  = dst_rect->w;
-	UINT const height = dst_rect->h;
-	UINT const dx     = src_rect->w;
-	UINT const dy     = src_rect->h;
-	UINT py = 0;
 	if (ssurface->flags & SDL_TRUE)
 	{
 //		const UINT16 key = ssurface->format->colorkey;
 		const UINT16 key = 0;
-		for (UINT iy = 0; iy < height; ++iy)
-		{
-			const UINT16* s = os;
-			UINT px = 0;
-			for (UINT ix = 0; ix < width; ++ix)
-			{
-				if (*s != key) *d = *s;
-				++d;
-				px += dx;
-				for (; px >= width; px -= width) ++s;
-			}
-			d += d_pitch - width;
-			py += dy;
-			for (; py >= height; py -= height) os += s_pitch;
-		}
+		StretchPixelsNearest(d, d_pitch, dst_rect->w, dst_rect->h, s, s_pitch, src_rect->w, src_rect->h, true, key);
+	}
+	else if (GetVideoScaleQuality() == VideoScaleQuality::LINEAR)
+	{
+		StretchPixelsBilinear(d, d_pitch, dst_rect->w, dst_rect->h, s, s_pitch, src_rect->w, src_rect->h);
 	}
 	else
 	{
-		for (UINT iy = 0; iy < height; ++iy)
-		{
-			const UINT16* s = os;
-			UINT px = 0;
-			for (UINT ix = 0; ix < width; ++ix)
-			{
-				*d++ = *s;
-				px += dx;
-				for (; px >= width; px -= width) ++s;
-			}
-			d += d_pitch - width;
-			py += dy;
-			for (; py >= height; py -= height) os += s_pitch;
-		}
+		StretchPixelsNearest(d, d_pitch, dst_rect->w, dst_rect->h, s, s_pitch, src_rect->w, src_rect->h, false, 0);
 	}
 }
 
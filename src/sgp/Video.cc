@@ -130,6 +130,12 @@ void VideoSetBrightness(float brightness)
 static void GetRGBDistribution();
 
 
+VideoScaleQuality GetVideoScaleQuality(void)
+{
+	return ScaleQuality;
+}
+
+
 void InitializeVideoManager(const VideoScaleQuality quality)
 {
 	SLOGD("Initializing the video manager");
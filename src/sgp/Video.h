@@ -15,6 +15,7 @@ using VideoScaleQuality = ScalingQuality;
 
 void         VideoSetFullScreen(BOOLEAN enable);
 void         InitializeVideoManager(VideoScaleQuality quality);
+VideoScaleQuality GetVideoScaleQuality(void);
 void         ShutdownVideoManager(void);
 void         SuspendVideoManager(void);
 void         InvalidateRegion(INT32 iLeft, INT32 iTop, INT32 iRight, INT32 iBottom);